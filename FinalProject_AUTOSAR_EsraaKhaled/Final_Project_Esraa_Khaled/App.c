@@ -7,24 +7,47 @@
 
 
 #include "App.h"
-#include "Mcu.h"
+#include "MCU.h"
 #include "Port.h"
 #include "Dio.h"
 #include "Button.h"
 #include "Led.h"
 
 
-/* Description: Task executes once to initialize all the Modules */
-void Init_Task(void)
+/* Description: Task executes once to initialize all the Modules, E_NOT_OK if the port clocks are not ready */
+Std_ReturnType Init_Task(void)
 {
-    /* Initialize Mcu Driver */
-    Mcu_Init();
+    Std_ReturnType status = E_NOT_OK;
 
-    /* Initialize Port Driver */
-    Port_Init(&Port_Configuration);
+    /*
+     * Run the core from the PLL. When the PLL does not lock the core keeps running from the 16 MHz PIOSC,
+     * the failure is kept by the Mcu driver (Mcu_GetPllStatus) and the OS timer follows Mcu_GetCoreClockFrequency.
+     */
+    if(E_OK != Mcu_InitClock())
+    {
+        /* Continue at the PIOSC frequency, Mcu_GetPllStatus reports MCU_PLL_UNLOCKED */
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Initialize Mcu Driver, the ports are accessible only when their clocks are ready, otherwise Port and Dio are not initialized */
+    if(E_OK == Mcu_Init())
+    {
+        /* Initialize Port Driver */
+        Port_Init(&Port_Configuration);
+
+        /* Initialize Dio Driver */
+        Dio_Init(&Dio_Configuration);
 
-    /* Initialize Dio Driver */
-    Dio_Init(&Dio_Configuration);
+        status = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return status;
 }
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
@@ -10,8 +10,8 @@
 
 #include "Std_Types.h"
 
-/* Description: Task executes once to initialize all the Modules */
-void Init_Task(void);
+/* Description: Task executes once to initialize all the Modules, E_NOT_OK if the port clocks are not ready */
+Std_ReturnType Init_Task(void);
 
 /* Description: Task executes every 20 Mili-seconds to check the button state */
 void Button_Task(void);
@@ -5,7 +5,7 @@
  * Author: Esraa Khaled
  */
 
-#include "Dio.h"
+#include "Dio_Inline.h"
 #include "Button.h"
 
 
@@ -21,7 +21,7 @@ uint8 Button_GetState(void)
 
 void Button_RefreshState(void)
 {
-    uint8 state = Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+    uint8 state = Dio_Read_SW1();
 
     /* Count the number of Pressed times increment if the switch pressed for 20 ms */
     static uint8 g_Pressed_Count  = 0;
@@ -7,6 +7,7 @@
 
 
 #include "Dio.h"
+#include "MCU.h"
 #include "tm4c123gh6pm_registers.h"
 
 #if(DIO_DEV_ERROR_DETECT == STD_ON)
@@ -22,10 +23,88 @@
 
 #endif
 
+/* Runtime descriptor of a configured channel, resolved once by Dio_Init */
+typedef struct
+{
+    /*
+     * Address of the DATA register of the port that this channel belongs to.
+     * In the masked address mode it is the GPIODATA aperture address decoding only this channel bit.
+     * In the bit-band mode it is the bit-band alias word of the channel bit in the DATA register.
+     */
+    uint32 Data_Reg_Address;
+    /* Precomputed mask of the channel bit inside its port */
+    uint8 Bit_Mask;
+    /* ID of the Port that this channel belongs to */
+    Dio_PortType Port_Num;
+}Dio_ChannelDescriptorType;
+
 /*Static Global Variables Definition*/
 STATIC const Dio_ConfigChannel *Dio_PortChannels = NULL_PTR;
 STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
+/* Channels resolved at initialization so every channel service is one indexed load and one register access */
+STATIC Dio_ChannelDescriptorType Dio_ChannelDescriptors[DIO_CONFIGURED_CHANNLES];
+
+/* Base address of every port indexed by the Port ID on the GPIO aperture selected in Mcu_Cfg.h */
+STATIC const uint32 Dio_PortBaseAddress[DIO_CONFIGURED_PORTS] =
+{
+    MCU_GPIO_PORTA_BASE_ADDRESS,
+    MCU_GPIO_PORTB_BASE_ADDRESS,
+    MCU_GPIO_PORTC_BASE_ADDRESS,
+    MCU_GPIO_PORTD_BASE_ADDRESS,
+    MCU_GPIO_PORTE_BASE_ADDRESS,
+    MCU_GPIO_PORTF_BASE_ADDRESS
+};
+
+/*
+ * GPIODATA decodes the address bits [9:2] as a mask of the bits affected by the access,
+ * so base + (mask << 2) reads or writes only the bits set in mask (0xFF --> DATA register at 0x3FC).
+ */
+#define DIO_DATA_APERTURE_ADDRESS(BASE,MASK)    ((BASE) + ((uint32)(MASK) << 2))
+
+/* Mask of all the 8 channels of a port */
+#define DIO_PORT_ALL_CHANNELS_MASK              (0xFFU)
+
+/* Bit-band alias word of one bit of a peripheral register */
+#define DIO_BIT_BAND_ALIAS_ADDRESS(ADDRESS,BIT) PERIPHERAL_BIT_BAND_ALIAS(ADDRESS, BIT)
+
+/* Set, clear and check the channel bit according to the selected access mode */
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ADDRESS)
+#define DIO_CHANNEL_PIN_SET(CHANNEL)            HW_REG_WRITE((CHANNEL)->Data_Reg_Address, (CHANNEL)->Bit_Mask)
+#define DIO_CHANNEL_PIN_CLEAR(CHANNEL)          HW_REG_WRITE((CHANNEL)->Data_Reg_Address, 0U)
+#define DIO_CHANNEL_IS_SET(CHANNEL)             (HW_REG_READ((CHANNEL)->Data_Reg_Address) != 0U)
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+#define DIO_CHANNEL_PIN_SET(CHANNEL)            HW_REG_WRITE((CHANNEL)->Data_Reg_Address, STD_HIGH)
+#define DIO_CHANNEL_PIN_CLEAR(CHANNEL)          HW_REG_WRITE((CHANNEL)->Data_Reg_Address, STD_LOW)
+#define DIO_CHANNEL_IS_SET(CHANNEL)             (HW_REG_READ((CHANNEL)->Data_Reg_Address) != 0U)
+#else
+#define DIO_CHANNEL_PIN_SET(CHANNEL)            HW_REG_SET_BITS((CHANNEL)->Data_Reg_Address, (CHANNEL)->Bit_Mask)
+#define DIO_CHANNEL_PIN_CLEAR(CHANNEL)          HW_REG_CLEAR_BITS((CHANNEL)->Data_Reg_Address, (CHANNEL)->Bit_Mask)
+#define DIO_CHANNEL_IS_SET(CHANNEL)             ((HW_REG_READ((CHANNEL)->Data_Reg_Address) & (CHANNEL)->Bit_Mask) != 0U)
+#endif
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+/* Writes only update the output image of the port, Dio_Commit flushes the changed ports */
+#define DIO_PORT_WRITE(PORT,MASK,LEVEL)         Dio_WriteOutputImage((PORT), (uint8)(MASK), (uint8)(LEVEL))
+#define DIO_CHANNEL_SET(CHANNEL)                DIO_PORT_WRITE((CHANNEL)->Port_Num, (CHANNEL)->Bit_Mask, (CHANNEL)->Bit_Mask)
+#define DIO_CHANNEL_CLEAR(CHANNEL)              DIO_PORT_WRITE((CHANNEL)->Port_Num, (CHANNEL)->Bit_Mask, 0U)
+#define DIO_CHANNEL_OUTPUT_IS_SET(CHANNEL)      ((Dio_OutputImage[(CHANNEL)->Port_Num] & (CHANNEL)->Bit_Mask) != 0U)
+#else
+/* Writes go directly to the port through the masked address aperture */
+#define DIO_PORT_WRITE(PORT,MASK,LEVEL)         HW_REG_WRITE(DIO_DATA_APERTURE_ADDRESS(Dio_PortBaseAddress[PORT], (MASK)), (LEVEL))
+#define DIO_CHANNEL_SET(CHANNEL)                DIO_CHANNEL_PIN_SET(CHANNEL)
+#define DIO_CHANNEL_CLEAR(CHANNEL)              DIO_CHANNEL_PIN_CLEAR(CHANNEL)
+#define DIO_CHANNEL_OUTPUT_IS_SET(CHANNEL)      DIO_CHANNEL_IS_SET(CHANNEL)
+#endif
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+/* RAM shadow of the output level of every port */
+uint8 Dio_OutputImage[DIO_CONFIGURED_PORTS];
+
+/* Bits of every port changed in the output image since the last Dio_Commit */
+uint8 Dio_OutputDirtyMask[DIO_CONFIGURED_PORTS];
+#endif
+
 
 /*Function Definitions*/
 
@@ -43,6 +122,12 @@ STATIC uint8 Dio_Status = DIO_NOT_INITIALIZED;
 
 void Dio_Init(const Dio_ConfigType * ConfigPtr)
 {
+    Dio_ChannelType channelIndex = 0;
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+    Dio_PortType portIndex = 0;
+    uint32 readyPorts = 0U;
+#endif
+
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
     /* check if the input configuration pointer is not a NULL_PTR */
     if (NULL_PTR == ConfigPtr)
@@ -59,6 +144,44 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
          */
         Dio_Status       = DIO_INITIALIZED;
         Dio_PortChannels = ConfigPtr->Channels; /* address of the first Channels structure --> Channels[0] */
+
+        /* Resolve the port DATA register and the bit mask of every channel once */
+        for(channelIndex = 0; channelIndex < DIO_CONFIGURED_CHANNLES; channelIndex++)
+        {
+            Dio_ChannelDescriptors[channelIndex].Bit_Mask         = (uint8)(1U << DIO_CHANNEL_CFG_CHANNEL(Dio_PortChannels[channelIndex]));
+            Dio_ChannelDescriptors[channelIndex].Port_Num         = DIO_CHANNEL_CFG_PORT(Dio_PortChannels[channelIndex]);
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ADDRESS)
+            /* Aperture address that decodes only the channel bit */
+            Dio_ChannelDescriptors[channelIndex].Data_Reg_Address = DIO_DATA_APERTURE_ADDRESS(Dio_PortBaseAddress[DIO_CHANNEL_CFG_PORT(Dio_PortChannels[channelIndex])],
+                                                                                              Dio_ChannelDescriptors[channelIndex].Bit_Mask);
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+            /* Bit-band alias word of the channel bit in the DATA register */
+            Dio_ChannelDescriptors[channelIndex].Data_Reg_Address = DIO_BIT_BAND_ALIAS_ADDRESS(Dio_PortBaseAddress[DIO_CHANNEL_CFG_PORT(Dio_PortChannels[channelIndex])]
+                                                                                                   + PORT_DATA_REG_OFFSET,
+                                                                                               DIO_CHANNEL_CFG_CHANNEL(Dio_PortChannels[channelIndex]));
+#else
+            /* Full DATA register of the port */
+            Dio_ChannelDescriptors[channelIndex].Data_Reg_Address = Dio_PortBaseAddress[DIO_CHANNEL_CFG_PORT(Dio_PortChannels[channelIndex])]
+                                                                  + PORT_DATA_REG_OFFSET;
+#endif
+        }
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+        /* Start the output image from the current level of the ports, the ports left gated by Mcu_Init are not accessible */
+        readyPorts = HW_REG_READ(SYSCTL_PRGPIO_REG_ADDRESS);
+        for(portIndex = 0; portIndex < DIO_CONFIGURED_PORTS; portIndex++)
+        {
+            if(readyPorts & (1UL << portIndex))
+            {
+                Dio_OutputImage[portIndex] = (uint8)HW_REG_READ(DIO_DATA_APERTURE_ADDRESS(Dio_PortBaseAddress[portIndex], DIO_PORT_ALL_CHANNELS_MASK));
+            }
+            else
+            {
+                Dio_OutputImage[portIndex] = 0U;
+            }
+            Dio_OutputDirtyMask[portIndex] = 0U;
+        }
+#endif
     }
 }
 
@@ -78,7 +201,7 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr)
 
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 {
-    volatile uint32 * Port_Ptr = NULL_PTR;
+    const Dio_ChannelDescriptorType * Channel_Ptr = NULL_PTR;
     boolean error = FALSE;
 
 #if (DIO_DEV_ERROR_DETECT == STD_ON)
@@ -110,31 +233,17 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
     /* In-case there are no errors */
     if(FALSE == error)
     {
-        /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-        switch(Dio_PortChannels[ChannelId].Port_Num)
-        {
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-                       break;
-            case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-                       break;
-            case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-                       break;
-            case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-                       break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-                       break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-                       break;
-        }
+        /* Channel descriptor resolved by Dio_Init */
+        Channel_Ptr = &Dio_ChannelDescriptors[ChannelId];
         if(Level == STD_HIGH)
         {
             /* Write Logic High */
-            SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+            DIO_CHANNEL_SET(Channel_Ptr);
         }
         else if(Level == STD_LOW)
         {
             /* Write Logic Low */
-            CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+            DIO_CHANNEL_CLEAR(Channel_Ptr);
         }
     }
     else
@@ -145,6 +254,114 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 }
 
 
+/*
+* Service Name: Dio_WriteChannels
+* Service ID[hex]: 0x20
+* Sync/Async: Synchronous
+* Reentrancy: Reentrant
+* Parameters (in): ChannelLevelList - List of channel IDs and the levels to be written.
+*                  NumberOfChannels - Number of the elements in the list.
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to set the levels of several channels at once. The requests are bucketed by port
+*              into one mask and one value, then one masked store is issued per touched port so the
+*              channels of a port change at the same instant. If a channel is repeated the last level wins,
+*              an entry with a level other than STD_HIGH/STD_LOW is skipped like in Dio_WriteChannel.
+* */
+
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+void Dio_WriteChannels(const Dio_ChannelLevelType * ChannelLevelList, uint8 NumberOfChannels)
+{
+    const Dio_ChannelDescriptorType * Channel_Ptr = NULL_PTR;
+    uint8 portMask[DIO_CONFIGURED_PORTS]  = {0U};
+    uint8 portLevel[DIO_CONFIGURED_PORTS] = {0U};
+    uint8 listIndex = 0U;
+    Dio_PortType portIndex = 0U;
+    boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_CHANNELS_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the input pointer is not a NULL_PTR */
+    if (NULL_PTR == ChannelLevelList)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    else
+    {
+        /* Check if all the used channels are within the valid range */
+        for(listIndex = 0U; listIndex < NumberOfChannels; listIndex++)
+        {
+            if (DIO_CONFIGURED_CHANNLES <= ChannelLevelList[listIndex].ChannelId)
+            {
+                Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                        DIO_WRITE_CHANNELS_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+                error = TRUE;
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Coalesce the requests into one mask and one value per port */
+        for(listIndex = 0U; listIndex < NumberOfChannels; listIndex++)
+        {
+            Channel_Ptr = &Dio_ChannelDescriptors[ChannelLevelList[listIndex].ChannelId];
+            if(ChannelLevelList[listIndex].Level == STD_HIGH)
+            {
+                portMask[Channel_Ptr->Port_Num]  |= Channel_Ptr->Bit_Mask;
+                portLevel[Channel_Ptr->Port_Num] |= Channel_Ptr->Bit_Mask;
+            }
+            else if(ChannelLevelList[listIndex].Level == STD_LOW)
+            {
+                portMask[Channel_Ptr->Port_Num]  |= Channel_Ptr->Bit_Mask;
+                portLevel[Channel_Ptr->Port_Num] &= (uint8)~Channel_Ptr->Bit_Mask;
+            }
+            else
+            {
+                /* Like Dio_WriteChannel, a level other than STD_HIGH/STD_LOW leaves the channel unchanged */
+            }
+        }
+
+        /* One masked store per touched port */
+        for(portIndex = 0U; portIndex < DIO_CONFIGURED_PORTS; portIndex++)
+        {
+            if(portMask[portIndex] != 0U)
+            {
+                DIO_PORT_WRITE(portIndex, portMask[portIndex], portLevel[portIndex]);
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+#endif
+
+
 /*
  * Service name: Dio_ReadChannel
  * Service ID[hex]: 0x00
@@ -160,7 +377,7 @@ void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
 
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 {
-    volatile uint32 * Port_Ptr = NULL_PTR;
+    const Dio_ChannelDescriptorType * Channel_Ptr = NULL_PTR;
     Dio_LevelType output = STD_LOW;
     boolean error = FALSE;
 
@@ -193,24 +410,10 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
     /* In-case there are no errors */
     if(FALSE == error)
     {
-        /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-        switch(Dio_PortChannels[ChannelId].Port_Num)
-        {
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-                       break;
-            case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-                       break;
-            case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-                       break;
-            case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-                       break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-                       break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-                       break;
-        }
+        /* Channel descriptor resolved by Dio_Init */
+        Channel_Ptr = &Dio_ChannelDescriptors[ChannelId];
         /* Read the required channel */
-        if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+        if(DIO_CHANNEL_IS_SET(Channel_Ptr))
         {
             output = STD_HIGH;
         }
@@ -227,6 +430,246 @@ Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
 }
 
 
+/*
+ * Service name: Dio_ReadPort
+ * Service ID[hex]: 0x02
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): PortId - ID of DIO Port
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Dio_PortLevelType -> Level of all channels of that port
+ * Description: Returns the level of all channels of that port with one access to the DATA register.
+*/
+
+Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId)
+{
+    Dio_PortLevelType output = 0U;
+    boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_PORT_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used port is within the valid range */
+    if (DIO_CONFIGURED_PORTS <= PortId)
+    {
+
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Sample the 8 pins of the port at the same instant */
+        output = (Dio_PortLevelType)HW_REG_READ(DIO_DATA_APERTURE_ADDRESS(Dio_PortBaseAddress[PortId], DIO_PORT_ALL_CHANNELS_MASK));
+    }
+    else
+    {
+        /* No Action Required */
+    }
+        return output;
+}
+
+
+/*
+ * Service name: Dio_WritePort
+ * Service ID[hex]: 0x03
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): PortId - ID of DIO Port
+ *                  Level - Value to be written
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the level of all channels of that port with one store to the DATA register.
+*/
+
+void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level)
+{
+    boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_PORT_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the used port is within the valid range */
+    if (DIO_CONFIGURED_PORTS <= PortId)
+    {
+
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_PORT_SID, DIO_E_PARAM_INVALID_PORT_ID);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Write the 8 pins of the port at the same instant (input pins are not affected by the hardware) */
+        DIO_PORT_WRITE(PortId, DIO_PORT_ALL_CHANNELS_MASK, Level);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
+/*
+ * Service name: Dio_ReadChannelGroup
+ * Service ID[hex]: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Dio_PortLevelType -> Level of a subset of the adjoining bits of a port
+ * Description: Reads a subset of the adjoining bits of a port with one access through the masked address aperture.
+*/
+
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr)
+{
+    Dio_PortLevelType output = 0U;
+    boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the input pointer is not a NULL_PTR */
+    if (NULL_PTR == ChannelGroupIdPtr)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    /* Check if the group belongs to a valid port */
+    else if (DIO_CONFIGURED_PORTS <= ChannelGroupIdPtr->PortIndex)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_READ_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* The aperture returns only the group bits, shift them to start from the LSB */
+        output = (Dio_PortLevelType)(HW_REG_READ(DIO_DATA_APERTURE_ADDRESS(Dio_PortBaseAddress[ChannelGroupIdPtr->PortIndex], ChannelGroupIdPtr->mask))
+                                     >> ChannelGroupIdPtr->offset);
+    }
+    else
+    {
+        /* No Action Required */
+    }
+        return output;
+}
+
+
+/*
+ * Service name: Dio_WriteChannelGroup
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup
+ *                  Level - Value to be written
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets a subset of the adjoining bits of a port with one glitch-free store
+ *              through the masked address aperture, the other bits of the port are not affected.
+*/
+
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+    boolean error = FALSE;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_UNINIT);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+    /* Check if the input pointer is not a NULL_PTR */
+    if (NULL_PTR == ChannelGroupIdPtr)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+        error = TRUE;
+    }
+    /* Check if the group belongs to a valid port */
+    else if (DIO_CONFIGURED_PORTS <= ChannelGroupIdPtr->PortIndex)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+        error = TRUE;
+    }
+    else
+    {
+        /* No Action Required */
+    }
+#endif
+
+    /* In-case there are no errors */
+    if(FALSE == error)
+    {
+        /* Shift the level to the group position, the aperture drops the bits outside the group mask */
+        DIO_PORT_WRITE(ChannelGroupIdPtr->PortIndex, ChannelGroupIdPtr->mask, ((uint32)Level << ChannelGroupIdPtr->offset));
+    }
+    else
+    {
+        /* No Action Required */
+    }
+}
+
+
 /*
  * Service Name: Dio_GetVersionInfo
  * Service ID[hex]: 0x12
@@ -282,7 +725,7 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo)
 #if (DIO_FLIP_CHANNEL_API == STD_ON)
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 {
-    volatile uint32 * Port_Ptr = NULL_PTR;
+    const Dio_ChannelDescriptorType * Channel_Ptr = NULL_PTR;
     Dio_LevelType output = STD_LOW;
     boolean error = FALSE;
 
@@ -315,31 +758,17 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
     /* In-case there are no errors */
     if(FALSE == error)
     {
-        /* Point to the correct PORT register according to the Port Id stored in the Port_Num member */
-        switch(Dio_PortChannels[ChannelId].Port_Num)
-        {
-            case 0:    Port_Ptr = &GPIO_PORTA_DATA_REG;
-                       break;
-            case 1:    Port_Ptr = &GPIO_PORTB_DATA_REG;
-                       break;
-            case 2:    Port_Ptr = &GPIO_PORTC_DATA_REG;
-                       break;
-            case 3:    Port_Ptr = &GPIO_PORTD_DATA_REG;
-                       break;
-            case 4:    Port_Ptr = &GPIO_PORTE_DATA_REG;
-                       break;
-            case 5:    Port_Ptr = &GPIO_PORTF_DATA_REG;
-                       break;
-        }
+        /* Channel descriptor resolved by Dio_Init */
+        Channel_Ptr = &Dio_ChannelDescriptors[ChannelId];
         /* Read the required channel and write the required level */
-        if(GET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num) == STD_HIGH)
+        if(DIO_CHANNEL_OUTPUT_IS_SET(Channel_Ptr))
         {
-            CLEAR_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+            DIO_CHANNEL_CLEAR(Channel_Ptr);
             output = STD_LOW;
         }
         else
         {
-            SET_BIT(*Port_Ptr,Dio_PortChannels[ChannelId].Ch_Num);
+            DIO_CHANNEL_SET(Channel_Ptr);
             output = STD_HIGH;
         }
     }
@@ -352,3 +781,56 @@ Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
 #endif
 
 
+/*
+* Service Name: Dio_Commit
+* Service ID[hex]: 0x21
+* Sync/Async: Synchronous
+* Reentrancy: Non Reentrant
+* Parameters (in): None
+* Parameters (inout): None
+* Parameters (out): None
+* Return value: None
+* Description: Function to flush the output image to the ports. Only the ports changed since the last
+*              commit are written, with one masked store per port that touches only the changed bits.
+*              It is called at the end of a task or from the OS tick.
+*/
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+void Dio_Commit(void)
+{
+    Dio_PortType portIndex = 0;
+    uint8 dirtyMask = 0U;
+    uint8 outputLevel = 0U;
+    uint32 primask;
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Check if the Driver is initialized before using this function */
+    if (DIO_NOT_INITIALIZED == Dio_Status)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID,
+                DIO_COMMIT_SID, DIO_E_UNINIT);
+    }
+    else
+#endif
+    {
+        for(portIndex = 0; portIndex < DIO_CONFIGURED_PORTS; portIndex++)
+        {
+            /* Take the changed bits and their levels together, a write preempting the commit is flushed by the next one */
+            Dio_EnterCritical(primask);
+            dirtyMask   = Dio_OutputDirtyMask[portIndex];
+            outputLevel = Dio_OutputImage[portIndex];
+            Dio_OutputDirtyMask[portIndex] = 0U;
+            Dio_ExitCritical(primask);
+
+            if(dirtyMask != 0U)
+            {
+                HW_REG_WRITE(DIO_DATA_APERTURE_ADDRESS(Dio_PortBaseAddress[portIndex], dirtyMask), outputLevel);
+            }
+            else
+            {
+                /* No Action Required */
+            }
+        }
+    }
+}
+#endif
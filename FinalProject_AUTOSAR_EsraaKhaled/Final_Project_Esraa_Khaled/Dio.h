@@ -35,6 +35,11 @@
 #define DIO_INITIALIZED                    (1U)
 #define DIO_NOT_INITIALIZED                (0U)
 
+/*Macros for the Dio channel access modes selected by DIO_CHANNEL_ACCESS_MODE*/
+#define DIO_ACCESS_READ_MODIFY_WRITE       (0U) /* Read-modify-write on the port DATA register */
+#define DIO_ACCESS_MASKED_ADDRESS          (1U) /* Single store through the GPIODATA address-mask aperture */
+#define DIO_ACCESS_BIT_BAND                (2U) /* Single aligned load/store on the Cortex-M4 bit-band alias word */
+
 
 /*Including Standard AUTOSAR Types*/
 #include "Std_Types.h"
@@ -97,6 +102,12 @@
 /* Service ID for DIO flip Channel */
 #define DIO_FLIP_CHANNEL_SID           (uint8)0x11
 
+/* Service ID for DIO write Channels (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_WRITE_CHANNELS_SID         (uint8)0x20
+
+/* Service ID for DIO commit output image (Not exist in AUTOSAR 4.0.3 DIO SWS Document) */
+#define DIO_COMMIT_SID                 (uint8)0x21
+
                             /*DET Error Codes*/
 
 /* DET code to report Invalid Channel */
@@ -149,13 +160,28 @@ typedef struct
   Dio_PortType PortIndex;
 } Dio_ChannelGroupType;
 
+/*
+ * Configuration of one channel packed in 8 bits:
+ *   bits [2:0] ID of the Port that this channel belongs to
+ *   bits [5:3] ID of the Channel inside its port
+ */
+typedef uint8 Dio_ConfigChannel;
+
+/* Build a packed channel entry at compile time */
+#define DIO_CHANNEL_CONFIG(PORT,CH)          ((Dio_ConfigChannel)(((uint8)(PORT) & 0x07U) | (((uint8)(CH) & 0x07U) << 3U)))
+
+/* Accessors of the packed channel entry */
+#define DIO_CHANNEL_CFG_PORT(CFG)            ((Dio_PortType)((CFG) & 0x07U))
+#define DIO_CHANNEL_CFG_CHANNEL(CFG)         ((uint8)(((CFG) >> 3U) & 0x07U))
+
+/* Channel and level pair used by Dio_WriteChannels */
 typedef struct
 {
-    /* Member contains the ID of the Port that this channel belongs to */
-    Dio_PortType Port_Num;
-    /* Member contains the ID of the Channel*/
-    Dio_ChannelType Ch_Num;
-}Dio_ConfigChannel;
+    /* ID of DIO channel */
+    Dio_ChannelType ChannelId;
+    /* Value to be written */
+    Dio_LevelType Level;
+}Dio_ChannelLevelType;
 
 /* Data Structure required for initializing the Dio Driver */
 typedef struct Dio_ConfigType
@@ -166,18 +192,29 @@ typedef struct Dio_ConfigType
 
                             /*Function Prototypes*/
 
-/* Function for DIO read Channel API */
+/* Function for DIO read Port API */
 Dio_PortLevelType Dio_ReadPort(Dio_PortType PortId);
 
-/* Function for DIO write Channel API */
+/* Function for DIO write Port API */
 void Dio_WritePort(Dio_PortType PortId, Dio_PortLevelType Level);
 
-/* Function for DIO read Port API */
+/* Function for DIO read Channel API */
 Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
 
-/* Function for DIO write Port API */
+/* Function for DIO write Channel API */
 void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
 
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+/* Function for DIO write Channels API */
+void Dio_WriteChannels(const Dio_ChannelLevelType * ChannelLevelList, uint8 NumberOfChannels);
+#endif
+
+/* Function for DIO read Channel Group API */
+Dio_PortLevelType Dio_ReadChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr);
+
+/* Function for DIO write Channel Group API */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType* ChannelGroupIdPtr, Dio_PortLevelType Level);
+
 /* Function for DIO Initialization API */
 void Dio_Init(const Dio_ConfigType * ConfigPtr);
 
@@ -186,6 +223,11 @@ void Dio_Init(const Dio_ConfigType * ConfigPtr);
 Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
 #endif
 
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+/* Function for DIO commit output image API */
+void Dio_Commit(void);
+#endif
+
 /* Function for DIO Get Version Info API */
 #if (DIO_VERSION_INFO_API == STD_ON)
 void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
@@ -198,4 +240,48 @@ void Dio_GetVersionInfo(Std_VersionInfoType *versioninfo);
 /*External PB Structures to be used by Dio and other Modules*/
 extern const Dio_ConfigType Dio_Configuration;
 
+/*External PB Channel Groups to be used with the Dio Channel Group APIs*/
+extern const Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS];
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+/* Output image of every port and the bits changed since the last Dio_Commit, shared with the fast path of Dio_Inline.h */
+extern uint8 Dio_OutputImage[DIO_CONFIGURED_PORTS];
+extern uint8 Dio_OutputDirtyMask[DIO_CONFIGURED_PORTS];
+
+#ifdef HOST_SIMULATION
+#include "Sim_Registers.h"
+
+/* On the host the PRIMASK is modeled by masking the simulated SysTick interrupt */
+#define Dio_EnterCritical(SAVED_PRIMASK)    ((SAVED_PRIMASK) = Sim_SaveAndDisableInterrupts())
+#define Dio_ExitCritical(SAVED_PRIMASK)     Sim_RestoreInterrupts(SAVED_PRIMASK)
+#else
+/*
+ * The output image is updated by read-modify-write in RAM from the tasks and the ISRs,
+ * the I-bit in the PRIMASK is set around every update so a preempting write is not lost.
+ * The PRIMASK of the caller is saved and restored, a caller that already masked the interrupts keeps them masked.
+ * The image accesses stay inside the critical section: the asm version clobbers the memory and
+ * the TI compiler does not move memory accesses across its interrupt intrinsics.
+ */
+#if defined(__TI_ARM__) && !defined(__clang__)
+/* TI ARM compiler intrinsics: MRS PRIMASK + CPSID I and MSR PRIMASK */
+#define Dio_EnterCritical(SAVED_PRIMASK)    ((SAVED_PRIMASK) = _disable_IRQ())
+#define Dio_ExitCritical(SAVED_PRIMASK)     _restore_interrupts(SAVED_PRIMASK)
+#else
+#define Dio_EnterCritical(SAVED_PRIMASK)    __asm volatile (" MRS %0, PRIMASK\n CPSID I" : "=r" (SAVED_PRIMASK) : : "memory")
+#define Dio_ExitCritical(SAVED_PRIMASK)     __asm volatile (" MSR PRIMASK, %0" : : "r" (SAVED_PRIMASK) : "memory")
+#endif
+#endif
+
+/* Update the bits of Mask in the output image of the port and mark them for the next commit */
+LOCAL_INLINE void Dio_WriteOutputImage(Dio_PortType PortId, uint8 Mask, uint8 Level)
+{
+    uint32 primask;
+
+    Dio_EnterCritical(primask);
+    Dio_OutputImage[PortId]      = (uint8)((Dio_OutputImage[PortId] & (uint8)~Mask) | (Level & Mask));
+    Dio_OutputDirtyMask[PortId] |= Mask;
+    Dio_ExitCritical(primask);
+}
+#endif
+
 #endif /* DIO_H_ */
@@ -27,16 +27,42 @@
 /*Pre-Compile Option for Adding/removing the service Dio_FlipChannel() from the code*/
 #define DIO_FLIP_CHANNEL_API                 (STD_ON)
 
+/*
+ * Pre-Compile Option for the channel access mode:
+ * DIO_ACCESS_MASKED_ADDRESS    --> one store through the GPIODATA address-mask aperture, no read and no critical section
+ * DIO_ACCESS_BIT_BAND          --> one aligned load/store on the bit-band alias word of the channel, no shift or mask
+ * DIO_ACCESS_READ_MODIFY_WRITE --> read-modify-write on the port DATA register
+ */
+#define DIO_CHANNEL_ACCESS_MODE              (DIO_ACCESS_MASKED_ADDRESS)
+
+/*Pre-Compile Option for Adding/removing the service Dio_WriteChannels() from the code*/
+#define DIO_WRITE_CHANNELS_API               (STD_ON)
+
+/*
+ * Pre-Compile Option for the output image mode:
+ * STD_ON  --> Dio writes only update a RAM shadow per port and Dio_Commit() flushes the changed ports
+ * STD_OFF --> Dio writes go directly to the ports
+ */
+#define DIO_OUTPUT_IMAGE_API                 (STD_OFF)
+
 /*Pre-Compile Option for Adding/removing the service Dio_ GetVersionInfo() from the code.*/
 #define DIO_VERSION_INFO_API                 (STD_OFF)
 
 /* Number of the configured Dio Channels */
 #define DIO_CONFIGURED_CHANNLES              (2U)
 
+/* Number of the GPIO Ports (PORTA --> PORTF) */
+#define DIO_CONFIGURED_PORTS                 (6U)
+
 /* Channel Index in the array of structures in Dio_PBcfg.c */
 #define DioConf_LED1_CHANNEL_ID_INDEX        (uint8)0x00
 #define DioConf_SW1_CHANNEL_ID_INDEX         (uint8)0x01
 
+/* Names of the configured channels used to generate the header-only fast path in Dio_Inline.h */
+#define DIO_CONFIGURED_CHANNELS_LIST(CHANNEL)\
+    CHANNEL(LED1)\
+    CHANNEL(SW1)
+
 /* DIO Configured Port ID's  */
 #define DioConf_LED1_PORT_NUM                (Dio_PortType)5 /* PORTF */
 #define DioConf_SW1_PORT_NUM                 (Dio_PortType)5 /* PORTF */
@@ -45,4 +71,23 @@
 #define DioConf_LED1_CHANNEL_NUM             (Dio_ChannelType)1 /* Pin 1 in PORTF */
 #define DioConf_SW1_CHANNEL_NUM              (Dio_ChannelType)4 /* Pin 4 in PORTF */
 
+/* Number of the configured Dio Channel Groups */
+#define DIO_CONFIGURED_GROUPS                (1U)
+
+/* Channel Group Index in the array of structures in Dio_PBcfg.c */
+#define DioConf_RGB_LEDS_GROUP_INDEX         (uint8)0x00
+
+/* DIO Configured Channel Groups (RGB Led on PF1 --> PF3) */
+#define DioConf_RGB_LEDS_GROUP_PORT_NUM      (Dio_PortType)5 /* PORTF */
+#define DioConf_RGB_LEDS_GROUP_MASK          (uint8)0x0E     /* Pins 1, 2 and 3 in PORTF */
+#define DioConf_RGB_LEDS_GROUP_OFFSET        (uint8)1        /* Group starts from Pin 1 */
+
+/* DIO Port ID's used with Dio_ReadPort / Dio_WritePort */
+#define DioConf_PORTA_ID                     (Dio_PortType)0
+#define DioConf_PORTB_ID                     (Dio_PortType)1
+#define DioConf_PORTC_ID                     (Dio_PortType)2
+#define DioConf_PORTD_ID                     (Dio_PortType)3
+#define DioConf_PORTE_ID                     (Dio_PortType)4
+#define DioConf_PORTF_ID                     (Dio_PortType)5
+
 #endif /* DIO_CFG_H_ */
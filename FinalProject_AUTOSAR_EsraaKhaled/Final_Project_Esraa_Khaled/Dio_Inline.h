@@ -0,0 +1,77 @@
+/*
+ * Module: Dio
+ * File Name: Dio_Inline.h
+ * Description: Header-only fast path for the channels configured in Dio_Cfg.h - Dio Driver
+ *              Every configured channel gets static inline read/write/flip accessors which resolve
+ *              to one constant-address load or store through the GPIODATA masked address aperture.
+ *              In the output image mode the writes resolve to a constant-index update of the port image instead,
+ *              the reads still sample the pin like Dio_ReadChannel.
+ *              Dio_ReadChannel/Dio_WriteChannel/Dio_FlipChannel remain available for dynamic channel IDs.
+ * Author: Esraa Khaled
+ */
+
+#ifndef DIO_INLINE_H_
+#define DIO_INLINE_H_
+
+#include "Dio.h"
+#include "MCU.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Base address of a port known at compile time (folded to a constant by the compiler) */
+#define DIO_INLINE_PORT_BASE_ADDRESS(PORT)       ((PORT) == 0U ? MCU_GPIO_PORTA_BASE_ADDRESS :\
+                                                  (PORT) == 1U ? MCU_GPIO_PORTB_BASE_ADDRESS :\
+                                                  (PORT) == 2U ? MCU_GPIO_PORTC_BASE_ADDRESS :\
+                                                  (PORT) == 3U ? MCU_GPIO_PORTD_BASE_ADDRESS :\
+                                                  (PORT) == 4U ? MCU_GPIO_PORTE_BASE_ADDRESS :\
+                                                                 MCU_GPIO_PORTF_BASE_ADDRESS)
+
+/* Constant aperture address that decodes only the channel bit */
+#define DIO_INLINE_CHANNEL_ADDRESS(PORT,CHANNEL) (DIO_INLINE_PORT_BASE_ADDRESS(PORT) + ((1UL << (CHANNEL)) << 2))
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+/* In the output image mode the writes update the image of the port like Dio_WriteChannel, Dio_Commit flushes it */
+#define DIO_INLINE_WRITE_ACCESSORS(NAME)\
+LOCAL_INLINE void Dio_Write_##NAME(Dio_LevelType Level)\
+{\
+    Dio_WriteOutputImage(DioConf_##NAME##_PORT_NUM, (uint8)(1U << DioConf_##NAME##_CHANNEL_NUM),\
+                         (Level == STD_HIGH) ? (uint8)(1U << DioConf_##NAME##_CHANNEL_NUM) : 0U);\
+}\
+LOCAL_INLINE Dio_LevelType Dio_Flip_##NAME(void)\
+{\
+    /* Flip the level last written to the image, as Dio_FlipChannel does */\
+    Dio_LevelType Level = ((Dio_OutputImage[DioConf_##NAME##_PORT_NUM] & (uint8)(1U << DioConf_##NAME##_CHANNEL_NUM)) != 0U) ? STD_LOW : STD_HIGH;\
+    Dio_Write_##NAME(Level);\
+    return Level;\
+}
+#else
+#define DIO_INLINE_WRITE_ACCESSORS(NAME)\
+LOCAL_INLINE void Dio_Write_##NAME(Dio_LevelType Level)\
+{\
+    /* One store, the other bits of the port are not affected */\
+    HW_REG_WRITE(DIO_INLINE_CHANNEL_ADDRESS(DioConf_##NAME##_PORT_NUM, DioConf_##NAME##_CHANNEL_NUM),\
+                 (Level == STD_HIGH) ? (1UL << DioConf_##NAME##_CHANNEL_NUM) : 0U);\
+}\
+LOCAL_INLINE Dio_LevelType Dio_Flip_##NAME(void)\
+{\
+    Dio_LevelType Level = (Dio_Read_##NAME() == STD_HIGH) ? STD_LOW : STD_HIGH;\
+    Dio_Write_##NAME(Level);\
+    return Level;\
+}
+#endif
+
+/*
+ * Generates Dio_Read_<NAME>, Dio_Write_<NAME> and Dio_Flip_<NAME> for the channel
+ * configured by DioConf_<NAME>_PORT_NUM and DioConf_<NAME>_CHANNEL_NUM in Dio_Cfg.h
+ */
+#define DIO_INLINE_CHANNEL_ACCESSORS(NAME)\
+LOCAL_INLINE Dio_LevelType Dio_Read_##NAME(void)\
+{\
+    /* The aperture returns only the channel bit */\
+    return (HW_REG_READ(DIO_INLINE_CHANNEL_ADDRESS(DioConf_##NAME##_PORT_NUM, DioConf_##NAME##_CHANNEL_NUM)) != 0U) ? STD_HIGH : STD_LOW;\
+}\
+DIO_INLINE_WRITE_ACCESSORS(NAME)
+
+/* Fast path accessors of all the channels listed in DIO_CONFIGURED_CHANNELS_LIST */
+DIO_CONFIGURED_CHANNELS_LIST(DIO_INLINE_CHANNEL_ACCESSORS)
+
+#endif /* DIO_INLINE_H_ */
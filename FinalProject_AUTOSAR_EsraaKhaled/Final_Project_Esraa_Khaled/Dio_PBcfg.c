@@ -36,6 +36,13 @@
 
 /* PB structure used with Dio_Init API */
 const Dio_ConfigType Dio_Configuration = {
-                                             DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM,
-                                             DioConf_SW1_PORT_NUM,  DioConf_SW1_CHANNEL_NUM
+                                             {
+                                                 DIO_CHANNEL_CONFIG(DioConf_LED1_PORT_NUM, DioConf_LED1_CHANNEL_NUM),
+                                                 DIO_CHANNEL_CONFIG(DioConf_SW1_PORT_NUM,  DioConf_SW1_CHANNEL_NUM)
+                                             }
+                                         };
+
+/* PB Channel Groups used with Dio_ReadChannelGroup / Dio_WriteChannelGroup APIs */
+const Dio_ChannelGroupType Dio_ChannelGroups[DIO_CONFIGURED_GROUPS] = {
+                                             {DioConf_RGB_LEDS_GROUP_MASK, DioConf_RGB_LEDS_GROUP_OFFSET, DioConf_RGB_LEDS_GROUP_PORT_NUM}
                                          };
@@ -7,15 +7,48 @@
 
 
 #include "Gpt.h"
+#include "MCU.h"
 #include "tm4c123gh6pm_registers.h"
 
 #define SYSTICK_PRIORITY_MASK           0x1FFFFFFF
 #define SYSTICK_INTERRUPT_PRIORITY      3
 #define SYSTICK_PRIORITY_BITS_POS       29
 
+/* The SysTick counts Reload + 1 cycles per period and Reload is a 24-bit value, Reload = 0 does not generate interrupts */
+#define SYSTICK_MIN_PERIOD_CYCLES       2UL
+#define SYSTICK_MAX_PERIOD_CYCLES       0x01000000UL
+
 /* Global pointer to function used to point upper layer functions to be used in Call Back */
 static void (*g_SysTick_Call_Back_Ptr)(void) = NULL_PTR;
 
+/* Period achieved by the Reload value of SysTick_Start in nano-seconds */
+static uint32 g_SysTick_Period_Ns = 0;
+
+/*
+ * Service Name: SysTick_ComputeReload
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Tick_Time - Time in micro-seconds
+ * Parameters (inout): None
+ * Parameters (out): Reload - Reload value of the period at the current core clock
+ * Return value: Std_ReturnType - E_NOT_OK if the period does not fit the 24-bit Reload at the current core clock
+ * Description: Function to convert a period to the Reload value rounded to the nearest cycle, without touching the timer.
+ *              The periods known in advance are converted once and written later in SYSTICK_RELOAD by the caller
+ *              (the 64-bit conversion is kept out of the interrupts)
+*/
+Std_ReturnType SysTick_ComputeReload(uint32 Tick_Time, uint32 *Reload)
+{
+    uint64 cycles = (((uint64)Mcu_GetCoreClockFrequency() * Tick_Time) + 500000ULL) / 1000000ULL;
+    Std_ReturnType status = E_NOT_OK;
+
+    if((cycles >= SYSTICK_MIN_PERIOD_CYCLES) && (cycles <= SYSTICK_MAX_PERIOD_CYCLES))
+    {
+        *Reload = (uint32)cycles - 1U;
+        status = E_OK;
+    }
+    return status;
+}
+
 /*
  * Service Name: SysTick_Handler
  * Description: SysTick Timer ISR
@@ -36,31 +69,88 @@ void SysTick_Handler(void)
  * Service Name: SysTick_Start
  * Sync/Async: Synchronous
  * Reentrancy: reentrant
- * Parameters (in): Tick_Time - Time in miliseconds
+ * Parameters (in): Tick_Time - Time in micro-seconds
  * Parameters (inout): None
  * Parameters (out): None
- * Return value: None
- * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
- *              - Set the Reload value
- *              - Enable SysTick Timer with System clock 16Mhz
+ * Return value: Std_ReturnType - E_NOT_OK if the period does not fit the 24-bit Reload at the current core clock
+ * Description: Function to Setup the SysTick Timer configuration to count n micro-seconds:
+ *              - Set the Reload value, the nearest count of core clock cycles (see SysTick_GetPeriod)
+ *              - Enable SysTick Timer with the System clock, the reload is scaled by Mcu_GetCoreClockFrequency
  *              - Enable SysTick Timer Interrupt and set its priority
 */
-void SysTick_Start(uint16 Tick_Time)
+Std_ReturnType SysTick_Start(uint32 Tick_Time)
 {
-    SYSTICK_CTRL_REG    = 0;                         /* Disable the SysTick Timer by Clear the ENABLE Bit */
-    SYSTICK_RELOAD_REG  = 15999 * Tick_Time;         /* Set the Reload value to count n miliseconds */
-    SYSTICK_CURRENT_REG = 0;                         /* Clear the Current Register value */
-    /* Configure the SysTick Control Register
-     * Enable the SysTick Timer (ENABLE = 1)
-     * Enable SysTick Interrupt (INTEN = 1)
-     * Choose the clock source to be System Clock (CLK_SRC = 1) */
-    SYSTICK_CTRL_REG   |= 0x07;
-    /* Assign priority level 3 to the SysTick Interrupt */
-    NVIC_SYSTEM_PRI3_REG =  (NVIC_SYSTEM_PRI3_REG & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS);
+    uint32 reload = 0U;
+    Std_ReturnType status = SysTick_ComputeReload(Tick_Time, &reload);
+
+    if(E_OK == status)
+    {
+        /* Period of Reload + 1 cycles rounded to the nearest nano-second */
+        g_SysTick_Period_Ns = (uint32)(((((uint64)reload + 1U) * 1000000000ULL) + (Mcu_GetCoreClockFrequency() / 2U))
+                                       / Mcu_GetCoreClockFrequency());
+
+        HW_REG_WRITE(SYSTICK_CTRL_REG_ADDRESS, 0);                /* Disable the SysTick Timer by Clear the ENABLE Bit */
+        HW_REG_WRITE(SYSTICK_RELOAD_REG_ADDRESS, reload);         /* Set the Reload value to count n micro-seconds */
+        HW_REG_WRITE(SYSTICK_CURRENT_REG_ADDRESS, 0);             /* Clear the Current Register value */
+        /* Configure the SysTick Control Register
+         * Enable the SysTick Timer (ENABLE = 1)
+         * Enable SysTick Interrupt (INTEN = 1)
+         * Choose the clock source to be System Clock (CLK_SRC = 1) */
+        HW_REG_SET_BITS(SYSTICK_CTRL_REG_ADDRESS, 0x07);
+        /* Assign priority level 3 to the SysTick Interrupt */
+        HW_REG_WRITE(NVIC_SYSTEM_PRI3_REG_ADDRESS,
+                     (HW_REG_READ(NVIC_SYSTEM_PRI3_REG_ADDRESS) & SYSTICK_PRIORITY_MASK) | (SYSTICK_INTERRUPT_PRIORITY << SYSTICK_PRIORITY_BITS_POS));
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return status;
 }
 
+/*
+ * Service Name: SysTick_SetNextPeriod
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Tick_Time - Time in micro-seconds
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_NOT_OK if the period does not fit the 24-bit Reload at the current core clock
+ * Description: Function to change the period of the running SysTick Timer from its next wrap:
+ *              - The running period is not disturbed, the HW loads the new Reload value when the counter reaches 0
+*/
+Std_ReturnType SysTick_SetNextPeriod(uint32 Tick_Time)
+{
+    uint32 reload = 0U;
+    Std_ReturnType status = SysTick_ComputeReload(Tick_Time, &reload);
 
+    if(E_OK == status)
+    {
+        HW_REG_WRITE(SYSTICK_RELOAD_REG_ADDRESS, reload);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return status;
+}
 
+/*
+ * Service Name: SysTick_GetPeriod
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Period achieved by the Reload value of SysTick_Start in nano-seconds
+ * Description: Function to get the period achieved by the Reload value, it differs from the requested one
+ *              when the requested period is not a whole number of core clock cycles.
+ *              The periods queued by SysTick_SetNextPeriod do not change it
+*/
+uint32 SysTick_GetPeriod(void)
+{
+    return g_SysTick_Period_Ns;
+}
 
 /*
  * Service Name: SysTick_Stop
@@ -74,7 +164,7 @@ void SysTick_Start(uint16 Tick_Time)
 */
 void SysTick_Stop(void)
 {
-    SYSTICK_CTRL_REG = 0; /* Disable the SysTick Timer by Clear the ENABLE Bit */
+    HW_REG_WRITE(SYSTICK_CTRL_REG_ADDRESS, 0); /* Disable the SysTick Timer by Clear the ENABLE Bit */
 }
 
 /*
@@ -17,16 +17,57 @@
  * Service Name: SysTick_Start
  * Sync/Async: Synchronous
  * Reentrancy: reentrant
- * Parameters (in): Tick_Time - Time in miliseconds
+ * Parameters (in): Tick_Time - Time in micro-seconds
  * Parameters (inout): None
  * Parameters (out): None
- * Return value: None
- * Description: Function to Setup the SysTick Timer configuration to count n miliseconds:
- *              - Set the Reload value
- *              - Enable SysTick Timer with System clock 16Mhz
+ * Return value: Std_ReturnType - E_NOT_OK if the period does not fit the 24-bit Reload at the current core clock
+ * Description: Function to Setup the SysTick Timer configuration to count n micro-seconds:
+ *              - Set the Reload value, the nearest count of core clock cycles (see SysTick_GetPeriod)
+ *              - Enable SysTick Timer with the System clock, the reload is scaled by Mcu_GetCoreClockFrequency
  *              - Enable SysTick Timer Interrupt and set its priority
 */
-void SysTick_Start(uint16 Tick_Time);
+Std_ReturnType SysTick_Start(uint32 Tick_Time);
+
+/*
+ * Service Name: SysTick_SetNextPeriod
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Tick_Time - Time in micro-seconds
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_NOT_OK if the period does not fit the 24-bit Reload at the current core clock
+ * Description: Function to change the period of the running SysTick Timer from its next wrap:
+ *              - The running period is not disturbed, the HW loads the new Reload value when the counter reaches 0
+*/
+Std_ReturnType SysTick_SetNextPeriod(uint32 Tick_Time);
+
+/*
+ * Service Name: SysTick_ComputeReload
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): Tick_Time - Time in micro-seconds
+ * Parameters (inout): None
+ * Parameters (out): Reload - Reload value of the period at the current core clock
+ * Return value: Std_ReturnType - E_NOT_OK if the period does not fit the 24-bit Reload at the current core clock
+ * Description: Function to convert a period to the Reload value rounded to the nearest cycle, without touching the timer.
+ *              The periods known in advance are converted once and written later in SYSTICK_RELOAD by the caller
+ *              (the 64-bit conversion is kept out of the interrupts)
+*/
+Std_ReturnType SysTick_ComputeReload(uint32 Tick_Time, uint32 *Reload);
+
+/*
+ * Service Name: SysTick_GetPeriod
+ * Sync/Async: Synchronous
+ * Reentrancy: reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint32 - Period achieved by the Reload value of SysTick_Start in nano-seconds
+ * Description: Function to get the period achieved by the Reload value, it differs from the requested one
+ *              when the requested period is not a whole number of core clock cycles.
+ *              The periods queued by SysTick_SetNextPeriod do not change it
+*/
+uint32 SysTick_GetPeriod(void);
 
 
 /*
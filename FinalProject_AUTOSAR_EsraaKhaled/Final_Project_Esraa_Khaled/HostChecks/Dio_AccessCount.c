@@ -0,0 +1,180 @@
+/*
+ * Module: Sim
+ * File Name: Dio_AccessCount.c
+ * Description: Host check counting the register accesses of the Dio services on the simulated MCU.
+ *              Every service is called DIO_CHECK_CALLS times after Mcu_Init/Port_Init/Dio_Init and the bus reads
+ *              and writes counted by Sim_Registers are printed per call. Rebuild after changing
+ *              DIO_CHANNEL_ACCESS_MODE in Dio_Cfg.h to compare the channel access modes, or MCU_GPIO_AHB_APERTURE
+ *              in Mcu_Cfg.h to check that every access goes through the selected aperture (the model faults on
+ *              the other one).
+ *              Build and run from the project directory:
+ *                  gcc -std=c99 -DHOST_SIMULATION -I. -o dio_access HostChecks/Dio_AccessCount.c \
+ *                      Dio.c Dio_PBcfg.c Port.c Port_PBcfg.c MCU.c Gpt.c Det.c Sim_Registers.c && ./dio_access
+ * Author: Esraa Khaled
+ */
+
+#ifdef HOST_SIMULATION
+
+#include <stdio.h>
+
+#include "MCU.h"
+#include "Port.h"
+#include "Dio.h"
+#include "Dio_Inline.h"
+#include "Sim_Registers.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Number of calls of every measured service, the counts are printed per call */
+#define DIO_CHECK_CALLS                   (100U)
+
+/* Length of the channel list written by Dio_WriteChannels and by the same number of Dio_WriteChannel calls */
+#define DIO_CHECK_LIST_LENGTH             (16U)
+
+/* Measured service: its name and a wrapper calling it once */
+typedef struct
+{
+    const char *Name;
+    void (*Run)(void);
+}Dio_CheckServiceType;
+
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+/* Configured channels repeated up to DIO_CHECK_LIST_LENGTH entries with alternating levels, filled in main */
+STATIC Dio_ChannelLevelType Dio_CheckChannelList[DIO_CHECK_LIST_LENGTH];
+#endif
+
+/*Private Functions*/
+
+STATIC void Dio_CheckWriteChannelHigh(void)
+{
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_HIGH);
+}
+
+STATIC void Dio_CheckWriteChannelLow(void)
+{
+    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX, STD_LOW);
+}
+
+STATIC void Dio_CheckReadChannel(void)
+{
+    (void)Dio_ReadChannel(DioConf_SW1_CHANNEL_ID_INDEX);
+}
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+STATIC void Dio_CheckFlipChannel(void)
+{
+    (void)Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+}
+#endif
+
+STATIC void Dio_CheckToggleLed(void)
+{
+    Dio_Write_LED1(STD_HIGH);
+    Dio_Write_LED1(STD_LOW);
+}
+
+STATIC void Dio_CheckReadPort(void)
+{
+    (void)Dio_ReadPort(DioConf_PORTF_ID);
+}
+
+STATIC void Dio_CheckWritePort(void)
+{
+    Dio_WritePort(DioConf_PORTF_ID, 0x02U);
+}
+
+STATIC void Dio_CheckReadChannelGroup(void)
+{
+    (void)Dio_ReadChannelGroup(&Dio_ChannelGroups[DioConf_RGB_LEDS_GROUP_INDEX]);
+}
+
+STATIC void Dio_CheckWriteChannelGroup(void)
+{
+    Dio_WriteChannelGroup(&Dio_ChannelGroups[DioConf_RGB_LEDS_GROUP_INDEX], 0x05U);
+}
+
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+STATIC void Dio_CheckWriteChannels(void)
+{
+    Dio_WriteChannels(Dio_CheckChannelList, DIO_CHECK_LIST_LENGTH);
+}
+
+STATIC void Dio_CheckWriteChannelList(void)
+{
+    uint8 listIndex = 0U;
+
+    for(listIndex = 0U; listIndex < DIO_CHECK_LIST_LENGTH; listIndex++)
+    {
+        Dio_WriteChannel(Dio_CheckChannelList[listIndex].ChannelId, Dio_CheckChannelList[listIndex].Level);
+    }
+}
+#endif
+
+STATIC const Dio_CheckServiceType Dio_CheckServices[] =
+{
+    {"Dio_WriteChannel(STD_HIGH)", Dio_CheckWriteChannelHigh},
+    {"Dio_WriteChannel(STD_LOW)",  Dio_CheckWriteChannelLow},
+    {"Dio_ReadChannel",            Dio_CheckReadChannel},
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    {"Dio_FlipChannel",            Dio_CheckFlipChannel},
+#endif
+    {"Dio_Write_LED1 high + low",  Dio_CheckToggleLed},
+    {"Dio_ReadPort",               Dio_CheckReadPort},
+    {"Dio_WritePort",              Dio_CheckWritePort},
+    {"Dio_ReadChannelGroup",       Dio_CheckReadChannelGroup},
+    {"Dio_WriteChannelGroup",      Dio_CheckWriteChannelGroup},
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+    {"Dio_WriteChannels(16 entries)", Dio_CheckWriteChannels},
+    {"16 x Dio_WriteChannel",         Dio_CheckWriteChannelList},
+#endif
+};
+
+#define DIO_CHECK_SERVICES                (sizeof(Dio_CheckServices) / sizeof(Dio_CheckServices[0]))
+
+/*Function Definitions*/
+
+int main(void)
+{
+    uint8 serviceIndex = 0U;
+    uint8 callIndex = 0U;
+
+    if(E_OK != Mcu_Init())
+    {
+        printf("Mcu_Init failed\n");
+        return 1;
+    }
+    Port_Init(&Port_Configuration);
+    Dio_Init(&Dio_Configuration);
+
+#if (DIO_WRITE_CHANNELS_API == STD_ON)
+    for(callIndex = 0U; callIndex < DIO_CHECK_LIST_LENGTH; callIndex++)
+    {
+        Dio_CheckChannelList[callIndex].ChannelId = (Dio_ChannelType)(callIndex % DIO_CONFIGURED_CHANNLES);
+        Dio_CheckChannelList[callIndex].Level     = (Dio_LevelType)(callIndex & 1U);
+    }
+#endif
+
+#if (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_MASKED_ADDRESS)
+    printf("Channel access mode: DIO_ACCESS_MASKED_ADDRESS\n");
+#elif (DIO_CHANNEL_ACCESS_MODE == DIO_ACCESS_BIT_BAND)
+    printf("Channel access mode: DIO_ACCESS_BIT_BAND\n");
+#else
+    printf("Channel access mode: DIO_ACCESS_READ_MODIFY_WRITE\n");
+#endif
+    printf("GPIO aperture: %s (ports on AHB in GPIOHBCTL = 0x%02lX)\n", (MCU_GPIO_AHB_APERTURE == STD_ON) ? "AHB" : "APB",
+           (unsigned long)(HW_REG_READ(SYSCTL_GPIOHBCTL_REG_ADDRESS) & MCU_GPIO_ALL_PORTS_MASK));
+    printf("%-36s %8s %8s\n", "Service (per call)", "Reads", "Writes");
+
+    for(serviceIndex = 0U; serviceIndex < DIO_CHECK_SERVICES; serviceIndex++)
+    {
+        Sim_ResetAccessCount();
+        for(callIndex = 0U; callIndex < DIO_CHECK_CALLS; callIndex++)
+        {
+            Dio_CheckServices[serviceIndex].Run();
+        }
+        printf("%-36s %8.2f %8.2f\n", Dio_CheckServices[serviceIndex].Name,
+               (double)Sim_GetReadCount() / DIO_CHECK_CALLS, (double)Sim_GetWriteCount() / DIO_CHECK_CALLS);
+    }
+    return 0;
+}
+
+#endif /* HOST_SIMULATION */
@@ -0,0 +1,146 @@
+/*
+ * Module: Sim
+ * File Name: Os_OverrunCheck.c
+ * Description: Host check of the overrun counters of the Os Scheduler on the simulated MCU.
+ *              It replaces the application tasks of App.c: Button_Task (every tick) stalls once for
+ *              OS_CHECK_SHORT_STALL_MS, shorter than two ticks, and once for OS_CHECK_LONG_STALL_MS,
+ *              three ticks arriving during the stall. The counters are compared after OS_CHECK_LAST_CALL calls.
+ *              Build and run from the project directory:
+ *                  gcc -std=c99 -DHOST_SIMULATION -I. -o os_overrun HostChecks/Os_OverrunCheck.c \
+ *                      $(ls *.c | grep -v -e App.c -e main.c) && ./os_overrun
+ * Author: Esraa Khaled
+ */
+
+#ifdef HOST_SIMULATION
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "App.h"
+#include "OS.h"
+#include "MCU.h"
+#include "Port.h"
+#include "Dio.h"
+
+/* Button_Task calls that stall and their stall time in ms, half a tick away from the tick edges (OS_BASE_TIME is 20 ms) */
+#define OS_CHECK_SHORT_STALL_CALL         (5U)
+#define OS_CHECK_SHORT_STALL_MS           (30U)
+#define OS_CHECK_LONG_STALL_CALL          (15U)
+#define OS_CHECK_LONG_STALL_MS            (70U)
+
+/* Button_Task call that compares the counters and ends the check */
+#define OS_CHECK_LAST_CALL                (25U)
+
+/*
+ * Expected counters, Button_Task call N runs at the tick of N * 20 ms until the long stall
+ * (App every 60 ms, Led every 40 ms):
+ * - Short stall at 100 ms: the tick of 120 ms arrives during it, the 100 ms tick overran.
+ *   Button, App and Led are late at 120 ms but run, no tick is pending behind it
+ * - Long stall at 300 ms: the ticks of 320, 340 and 360 ms arrive during it, the ticks of 300, 320 and 340 ms overran.
+ *   Button (skip) drops 320 and 340 ms, Led (skip) drops 320 ms, all of them run late at 360 ms
+ */
+#define OS_CHECK_EXPECTED_TICK_OVERRUNS   (4U)
+#define OS_CHECK_EXPECTED_BUTTON_OVERRUNS (4U)
+#define OS_CHECK_EXPECTED_APP_OVERRUNS    (2U)
+#define OS_CHECK_EXPECTED_LED_OVERRUNS    (3U)
+
+STATIC uint32 Os_CheckButtonCalls = 0U;
+
+/*Private Functions*/
+
+/* Busy wait, the SysTick host timer keeps raising ticks during it */
+STATIC void Os_CheckStall(uint32 Milliseconds)
+{
+    struct timespec start;
+    struct timespec now;
+    long elapsedMs;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    do
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        elapsedMs = ((now.tv_sec - start.tv_sec) * 1000L) + ((now.tv_nsec - start.tv_nsec) / 1000000L);
+    }while(elapsedMs < (long)Milliseconds);
+}
+
+STATIC uint8 Os_CheckCounter(const char *Name, uint32 Actual, uint32 Expected)
+{
+    uint8 failed = (Actual != Expected) ? 1U : 0U;
+
+    printf("%-16s %4lu (expected %lu) %s\n", Name, (unsigned long)Actual, (unsigned long)Expected,
+           (failed == 0U) ? "PASS" : "FAIL");
+    return failed;
+}
+
+/*Application Tasks*/
+
+Std_ReturnType Init_Task(void)
+{
+    Std_ReturnType status = E_NOT_OK;
+
+    (void)Mcu_InitClock();
+    if(E_OK == Mcu_Init())
+    {
+        Port_Init(&Port_Configuration);
+        Dio_Init(&Dio_Configuration);
+        status = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return status;
+}
+
+void Button_Task(void)
+{
+    uint8 failures = 0U;
+
+    Os_CheckButtonCalls++;
+    if(Os_CheckButtonCalls == OS_CHECK_SHORT_STALL_CALL)
+    {
+        Os_CheckStall(OS_CHECK_SHORT_STALL_MS);
+    }
+    else if(Os_CheckButtonCalls == OS_CHECK_LONG_STALL_CALL)
+    {
+        Os_CheckStall(OS_CHECK_LONG_STALL_MS);
+    }
+    else if(Os_CheckButtonCalls == OS_CHECK_LAST_CALL)
+    {
+        failures += Os_CheckCounter("Tick overruns", Os_GetTickOverrunCount(), OS_CHECK_EXPECTED_TICK_OVERRUNS);
+        failures += Os_CheckCounter("Button overruns", Os_GetTaskOverrunCount(OsConf_Button_Task_ID),
+                                    OS_CHECK_EXPECTED_BUTTON_OVERRUNS);
+        failures += Os_CheckCounter("App overruns", Os_GetTaskOverrunCount(OsConf_App_Task_ID),
+                                    OS_CHECK_EXPECTED_APP_OVERRUNS);
+        failures += Os_CheckCounter("Led overruns", Os_GetTaskOverrunCount(OsConf_Led_Task_ID),
+                                    OS_CHECK_EXPECTED_LED_OVERRUNS);
+        printf("%s\n", (failures == 0U) ? "PASS" : "FAIL");
+        exit((failures == 0U) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+void App_Task(void)
+{
+    /* Do Nothing */
+}
+
+void Led_Task(void)
+{
+    /* Do Nothing */
+}
+
+int main(void)
+{
+    (void)Os_start();
+    printf("FAIL: the Os did not start\n");
+    return EXIT_FAILURE;
+}
+
+#endif /* HOST_SIMULATION */
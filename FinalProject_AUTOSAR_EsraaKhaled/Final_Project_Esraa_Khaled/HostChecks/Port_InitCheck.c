@@ -0,0 +1,270 @@
+/*
+ * Module: Sim
+ * File Name: Port_InitCheck.c
+ * Description: Host check of the GPIO registers programmed by the Port driver on the simulated MCU.
+ *              The expected value of every register is rebuilt here pin by pin from the pins lists of Port_PBcfg.c
+ *              (included below to reach its configuration macros), on top of the values read before Port_Init.
+ *              It does not use the register images generated in Port_PBcfg.c. The registers are checked after:
+ *              - Port_Init with the normal configuration set
+ *              - Port_SwitchConfig to the standby configuration set and back to the normal one
+ *              Build and run from the project directory, the exit status is 0 when all the registers match:
+ *                  gcc -std=c99 -DHOST_SIMULATION -I. -o port_check HostChecks/Port_InitCheck.c \
+ *                      Port.c MCU.c Gpt.c Det.c Sim_Registers.c && ./port_check
+ * Author: Esraa Khaled
+ */
+
+#ifdef HOST_SIMULATION
+
+#include <stdio.h>
+#include <string.h>
+
+#include "MCU.h"
+#include "Port.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* Configuration sets and their pins lists, linked from here instead of Port_PBcfg.c */
+#include "Port_PBcfg.c"
+
+/* Checked registers of a port */
+typedef enum
+{
+    PORT_CHECK_DATA,
+    PORT_CHECK_DIR,
+    PORT_CHECK_AFSEL,
+    PORT_CHECK_DR2R,
+    PORT_CHECK_DR4R,
+    PORT_CHECK_DR8R,
+    PORT_CHECK_ODR,
+    PORT_CHECK_PUR,
+    PORT_CHECK_PDR,
+    PORT_CHECK_SLR,
+    PORT_CHECK_DEN,
+    PORT_CHECK_CR,
+    PORT_CHECK_AMSEL,
+    PORT_CHECK_PCTL,
+    PORT_CHECK_REGISTERS
+}Port_CheckRegisterIndexType;
+
+/* Name and offset of a checked register, in the order of Port_CheckRegisterIndexType */
+typedef struct
+{
+    const char *Name;
+    uint32 Offset;
+}Port_CheckRegisterType;
+
+/* Parameters of one pin of a pins list */
+typedef struct
+{
+    uint8 Port_Num;
+    uint8 Pin_Num;
+    Port_PinDirectionType Direction;
+    Port_InternalResistorType Resistor;
+    Port_PinModeType Mode;
+    Port_PinLevelValueType Initial_Value;
+    uint8 Drive;
+    uint8 Pmc;
+}Port_CheckPinType;
+
+/* Register values of all the ports */
+typedef uint32 Port_CheckPortsType[PORT_CONFIGURED_PORTS][PORT_CHECK_REGISTERS];
+
+/* Set or clear the bits BIT of REG */
+#define PORT_CHECK_WRITE_BITS(REG,BIT,SET)       ((REG) = ((REG) & ~(BIT)) | ((SET) ? (BIT) : 0UL))
+
+/* Pins list entry of the check tables */
+#define PORT_CHECK_PIN(P,PRED,PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE,PMC) {PORT, PIN, DIR, RES, MODE, INIT, DRIVE, PMC},
+
+STATIC const Port_CheckRegisterType Port_CheckRegisters[PORT_CHECK_REGISTERS] =
+{
+    {"DATA",  PORT_DATA_REG_OFFSET},
+    {"DIR",   PORT_DIR_REG_OFFSET},
+    {"AFSEL", PORT_AFSEL_REG_OFFSET},
+    {"DR2R",  PORT_DR2R_REG_OFFSET},
+    {"DR4R",  PORT_DR4R_REG_OFFSET},
+    {"DR8R",  PORT_DR8R_REG_OFFSET},
+    {"ODR",   PORT_ODR_REG_OFFSET},
+    {"PUR",   PORT_PUR_REG_OFFSET},
+    {"PDR",   PORT_PDR_REG_OFFSET},
+    {"SLR",   PORT_SLR_REG_OFFSET},
+    {"DEN",   PORT_DEN_REG_OFFSET},
+    {"CR",    PORT_CR_REG_OFFSET},
+    {"AMSEL", PORT_AMSEL_REG_OFFSET},
+    {"PCTL",  PORT_PCTL_REG_OFFSET}
+};
+
+/* Base address of every port on the GPIO aperture selected in Mcu_Cfg.h */
+STATIC const uint32 Port_CheckBaseAddress[PORT_CONFIGURED_PORTS] =
+{
+    MCU_GPIO_PORTA_BASE_ADDRESS,
+    MCU_GPIO_PORTB_BASE_ADDRESS,
+    MCU_GPIO_PORTC_BASE_ADDRESS,
+    MCU_GPIO_PORTD_BASE_ADDRESS,
+    MCU_GPIO_PORTE_BASE_ADDRESS,
+    MCU_GPIO_PORTF_BASE_ADDRESS
+};
+
+STATIC const Port_CheckPinType Port_CheckNormalPins[] =
+{
+    PORT_NORMAL_PINS_LIST(PORT_CHECK_PIN, 0, 0)
+};
+
+STATIC const Port_CheckPinType Port_CheckStandbyPins[] =
+{
+    PORT_STANDBY_PINS_LIST(PORT_CHECK_PIN, 0, 0)
+};
+
+#define PORT_CHECK_PINS_COUNT(PINS)              ((uint8)(sizeof(PINS) / sizeof((PINS)[0])))
+
+/* Register values read before Port_Init */
+STATIC Port_CheckPortsType Port_CheckResetValues;
+
+/*Private Functions*/
+
+/* Read the checked registers of all the ports clocked by Mcu_Init */
+STATIC void Port_CheckReadPorts(Port_CheckPortsType Values)
+{
+    uint8 portIndex = 0U;
+    uint8 regIndex = 0U;
+
+    for(portIndex = 0U; portIndex < PORT_CONFIGURED_PORTS; portIndex++)
+    {
+        for(regIndex = 0U; regIndex < PORT_CHECK_REGISTERS; regIndex++)
+        {
+            Values[portIndex][regIndex] = (Port_UsedPortsMask & (1U << portIndex))
+                ? HW_REG_READ(Port_CheckBaseAddress[portIndex] + Port_CheckRegisters[regIndex].Offset) : 0UL;
+        }
+    }
+}
+
+/*
+ * Expected registers after applying a pins list, from the datasheet meaning of every pin parameter.
+ * The JTAG pins PC0-PC3 and the bits of the pins that are not configured keep their reset value,
+ * the pull resistors of the output pins are not changed.
+ */
+STATIC void Port_CheckBuildExpected(const Port_CheckPinType *Pins, uint8 PinsCount, Port_CheckPortsType Expected)
+{
+    const Port_CheckPinType *pin = NULL_PTR;
+    uint32 *regs = NULL_PTR;
+    uint32 bit = 0UL;
+    uint8 pinIndex = 0U;
+    uint8 strength = 0U;
+    boolean output = FALSE;
+    boolean analog = FALSE;
+    boolean alternate = FALSE;
+
+    memcpy(Expected, Port_CheckResetValues, sizeof(Port_CheckPortsType));
+
+    for(pinIndex = 0U; pinIndex < PinsCount; pinIndex++)
+    {
+        pin = &Pins[pinIndex];
+        if((pin->Port_Num == PORT_PORTC_ID) && (pin->Pin_Num <= PORT_PIN3_ID))
+        {
+            continue;
+        }
+
+        regs      = Expected[pin->Port_Num];
+        bit       = 1UL << pin->Pin_Num;
+        strength  = pin->Drive & PORT_PIN_DRIVE_STRENGTH_MASK;
+        output    = (pin->Direction == PORT_PIN_OUT) ? TRUE : FALSE;
+        analog    = (pin->Mode == PORT_PIN_MODE_ADC) ? TRUE : FALSE;
+        alternate = ((pin->Mode != PORT_PIN_MODE_DIO) && (analog == FALSE)) ? TRUE : FALSE;
+
+        /* Every configured pin is committed, including the locked pins PD7 and PF0 */
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_CR], bit, TRUE);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_AMSEL], bit, analog);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_AFSEL], bit, alternate);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_PCTL], 0xFUL << (pin->Pin_Num * 4U), FALSE);
+        regs[PORT_CHECK_PCTL] |= (alternate == TRUE) ? ((uint32)pin->Pmc << (pin->Pin_Num * 4U)) : 0UL;
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_DR2R], bit, strength == PORT_PIN_DRIVE_2MA);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_DR4R], bit, strength == PORT_PIN_DRIVE_4MA);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_DR8R], bit, strength == PORT_PIN_DRIVE_8MA);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_SLR], bit, (strength == PORT_PIN_DRIVE_8MA) && (pin->Drive & PORT_PIN_SLEW_RATE_CONTROL));
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_ODR], bit, pin->Drive & PORT_PIN_OPEN_DRAIN);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_DEN], bit, analog == FALSE);
+        PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_DIR], bit, output);
+        if(output == TRUE)
+        {
+            PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_DATA], bit, pin->Initial_Value == PORT_PIN_LEVEL_HIGH);
+        }
+        else
+        {
+            PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_PUR], bit, pin->Resistor == PULL_UP);
+            PORT_CHECK_WRITE_BITS(regs[PORT_CHECK_PDR], bit, pin->Resistor == PULL_DOWN);
+        }
+    }
+}
+
+/*
+ * Compare the registers of all the clocked ports with the expected ones and print every mismatch.
+ * GPIODATA reads the pin levels, only the digital push-pull outputs are compared
+ * (a high open-drain output releases its pin).
+ * Return value: number of the mismatching registers
+ */
+STATIC uint16 Port_CheckCompare(const char *Step, const Port_CheckPortsType Expected)
+{
+    Port_CheckPortsType actual;
+    uint32 mask = 0UL;
+    uint16 errors = 0U;
+    uint16 checked = 0U;
+    uint8 portIndex = 0U;
+    uint8 regIndex = 0U;
+
+    Port_CheckReadPorts(actual);
+    for(portIndex = 0U; portIndex < PORT_CONFIGURED_PORTS; portIndex++)
+    {
+        if(!(Port_UsedPortsMask & (1U << portIndex)))
+        {
+            continue;
+        }
+        for(regIndex = 0U; regIndex < PORT_CHECK_REGISTERS; regIndex++)
+        {
+            mask = (regIndex == PORT_CHECK_DATA)
+                 ? (Expected[portIndex][PORT_CHECK_DIR] & Expected[portIndex][PORT_CHECK_DEN] & ~Expected[portIndex][PORT_CHECK_ODR])
+                 : 0xFFFFFFFFUL;
+            if((actual[portIndex][regIndex] & mask) != (Expected[portIndex][regIndex] & mask))
+            {
+                printf("FAIL %s: PORT%c %-5s = 0x%08lX, expected 0x%08lX\n", Step, 'A' + portIndex,
+                       Port_CheckRegisters[regIndex].Name, (unsigned long)(actual[portIndex][regIndex] & mask),
+                       (unsigned long)(Expected[portIndex][regIndex] & mask));
+                errors++;
+            }
+            checked++;
+        }
+    }
+    printf("%s %s: %u registers checked\n", (errors == 0U) ? "PASS" : "FAIL", Step, checked);
+    return errors;
+}
+
+/*Function Definitions*/
+
+int main(void)
+{
+    Port_CheckPortsType normal;
+    Port_CheckPortsType standby;
+    uint16 errors = 0U;
+
+    if(E_OK != Mcu_Init())
+    {
+        printf("FAIL Mcu_Init\n");
+        return 1;
+    }
+
+    Port_CheckReadPorts(Port_CheckResetValues);
+    Port_CheckBuildExpected(Port_CheckNormalPins, PORT_CHECK_PINS_COUNT(Port_CheckNormalPins), normal);
+    Port_CheckBuildExpected(Port_CheckStandbyPins, PORT_CHECK_PINS_COUNT(Port_CheckStandbyPins), standby);
+
+    Port_Init(&Port_Configuration);
+    errors += Port_CheckCompare("Port_Init normal set", normal);
+
+#if (PORT_SWITCH_CONFIG_API == STD_ON)
+    Port_SwitchConfig(PortConf_NORMAL_CONFIG_SET, PortConf_STANDBY_CONFIG_SET);
+    errors += Port_CheckCompare("Port_SwitchConfig normal --> standby", standby);
+
+    Port_SwitchConfig(PortConf_STANDBY_CONFIG_SET, PortConf_NORMAL_CONFIG_SET);
+    errors += Port_CheckCompare("Port_SwitchConfig standby --> normal", normal);
+#endif
+
+    return (errors == 0U) ? 0 : 1;
+}
+
+#endif /* HOST_SIMULATION */
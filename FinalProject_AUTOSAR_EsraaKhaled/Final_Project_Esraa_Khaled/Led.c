@@ -5,30 +5,34 @@
  * Author: Esraa Khaled
  */
 
-#include "Dio.h"
+#include "Dio_Inline.h"
 #include "Led.h"
 
+/* Global variable to hold the last level written to the LED */
+static Dio_LevelType g_led_state = LED_OFF;
+
 
 void Led_SetOn(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_ON);  /* LED ON */
+    g_led_state = LED_ON;
+    Dio_Write_LED1(LED_ON);  /* LED ON */
 }
 
 
 void Led_SetOff(void)
 {
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,LED_OFF); /* LED OFF */
+    g_led_state = LED_OFF;
+    Dio_Write_LED1(LED_OFF); /* LED OFF */
 }
 
 
 void Led_RefreshOutput(void)
 {
-    Dio_LevelType state = Dio_ReadChannel(DioConf_LED1_CHANNEL_ID_INDEX);
-    Dio_WriteChannel(DioConf_LED1_CHANNEL_ID_INDEX,state); /* re-write the same value */
+    Dio_Write_LED1(g_led_state); /* re-write the last level set, the pin is not read back (see Led.h) */
 }
 
 
 void Led_Toggle(void)
 {
-    Dio_LevelType state = Dio_FlipChannel(DioConf_LED1_CHANNEL_ID_INDEX);
+    g_led_state = Dio_Flip_LED1();
 }
@@ -27,7 +27,10 @@ void Led_SetOff(void);
 /*Description: Toggle the LED state */
 void Led_Toggle(void);
 
-/* Description: Refresh the LED state */
+/* Description: Refresh the LED state: write again the last level set by Led_SetOn/Led_SetOff/Led_Toggle.
+ *              The pin is not read back, in the Dio output image mode the pin follows only at Dio_Commit
+ *              and reading it would undo a level written earlier in the same tick.
+ */
 void Led_RefreshOutput(void);
 
 #endif /* LED_H_ */
@@ -6,13 +6,126 @@
  */
 
 
+#include "MCU.h"
+#include "Port.h"
 #include "tm4c123gh6pm_registers.h"
 
-void Mcu_Init(void)
+/* Frequency of the precision internal oscillator that clocks the core after reset */
+#define MCU_PIOSC_CLOCK_HZ              (16000000UL)
+/* PLL output frequency when DIV400 is set */
+#define MCU_PLL_CLOCK_HZ                (400000000UL)
+
+#if ((MCU_PLL_ENABLE == STD_ON) && ((MCU_PLL_SYSDIV < 4U) || (MCU_PLL_SYSDIV > 127U)))
+#error "MCU_PLL_SYSDIV must be in 4 --> 127, the core clock cannot exceed 80 MHz"
+#endif
+
+/* SYSCTL RCC register fields */
+#define MCU_RCC_MOSCDIS                 (0x00000001UL)
+#define MCU_RCC_XTAL_MASK               (0x000007C0UL)
+#define MCU_RCC_XTAL_POS                (6U)
+
+/* SYSCTL RCC2 register fields */
+#define MCU_RCC2_USERCC2                (0x80000000UL)
+#define MCU_RCC2_DIV400                 (0x40000000UL)
+#define MCU_RCC2_SYSDIV_MASK            (0x1FC00000UL)
+#define MCU_RCC2_SYSDIV_POS             (22U)
+#define MCU_RCC2_PWRDN2                 (0x00002000UL)
+#define MCU_RCC2_BYPASS2                (0x00000800UL)
+#define MCU_RCC2_OSCSRC2_MASK           (0x00000070UL)
+#define MCU_RCC2_OSCSRC2_PIOSC          (0x00000010UL)
+
+/* PLL lock bit in SYSCTL RIS register */
+#define MCU_RIS_PLLLRIS                 (0x00000040UL)
+
+/* Frequency of the clock that drives the core, updated when Mcu_InitClock switches to the PLL */
+STATIC uint32 Mcu_CoreClockHz = MCU_PIOSC_CLOCK_HZ;
+
+/* Lock status of the PLL recorded by Mcu_InitClock */
+STATIC Mcu_PllStatusType Mcu_PllStatus = MCU_PLL_STATUS_UNDEFINED;
+
+/*
+ * Runs from ResetISR before .data/.bss are initialized, so it only uses constants located in flash.
+ * The ports get ready while the C runtime initializes the memory.
+ */
+void Mcu_StartPortClocks(void)
+{
+#if (MCU_GPIO_AHB_APERTURE == STD_ON)
+    /*Move all ports to the AHB aperture before any access from Port and Dio drivers*/
+    HW_REG_SET_BITS(SYSCTL_GPIOHBCTL_REG_ADDRESS, MCU_GPIO_ALL_PORTS_MASK);
+#endif
+
+    /*Enable Clock only for the ports used by the Port configuration sets, the others stay gated*/
+    HW_REG_SET_BITS(SYSCTL_RCGCGPIO_REG_ADDRESS, Port_UsedPortsMask);
+}
+
+Std_ReturnType Mcu_Init(void)
+{
+    uint32 readyTimeout = MCU_GPIO_READY_TIMEOUT;
+
+    /*Already done by the startup code on the target, setting the bits again is harmless*/
+    Mcu_StartPortClocks();
+
+    /*Wait for all the used ports to be ready, not only for the first one*/
+    while(((HW_REG_READ(SYSCTL_PRGPIO_REG_ADDRESS) & Port_UsedPortsMask) != Port_UsedPortsMask) && (readyTimeout > 0U))
+    {
+        readyTimeout--;
+    }
+
+    return (((HW_REG_READ(SYSCTL_PRGPIO_REG_ADDRESS) & Port_UsedPortsMask) == Port_UsedPortsMask) ? E_OK : E_NOT_OK);
+}
+
+
+
+Std_ReturnType Mcu_InitClock(void)
 {
-    /*Enable Clock for all ports and wait for the clock to start*/
-    SYSCTL_RCGCGPIO_REG |= 0x3F;
-    while(!(SYSCTL_PRGPIO_REG & 0x3F));
+    Std_ReturnType status = E_OK;
+#if (MCU_PLL_ENABLE == STD_ON)
+    uint32 lockTimeout = MCU_PLL_LOCK_TIMEOUT;
+
+    /*Use RCC2 for the extended fields and keep the core on the raw oscillator while the PLL is configured*/
+    HW_REG_SET_BITS(SYSCTL_RCC2_REG_ADDRESS, MCU_RCC2_USERCC2 | MCU_RCC2_BYPASS2);
+
+    /*Enable the main oscillator with the crystal frequency and select it as the PLL input*/
+    HW_REG_WRITE(SYSCTL_RCC_REG_ADDRESS, (HW_REG_READ(SYSCTL_RCC_REG_ADDRESS) & ~(MCU_RCC_XTAL_MASK | MCU_RCC_MOSCDIS))
+                                         | ((uint32)MCU_PLL_XTAL << MCU_RCC_XTAL_POS));
+    HW_REG_CLEAR_BITS(SYSCTL_RCC2_REG_ADDRESS, MCU_RCC2_OSCSRC2_MASK);
+
+    /*Power up the PLL and divide its 400 MHz output by MCU_PLL_SYSDIV + 1*/
+    HW_REG_CLEAR_BITS(SYSCTL_RCC2_REG_ADDRESS, MCU_RCC2_PWRDN2);
+    HW_REG_WRITE(SYSCTL_RCC2_REG_ADDRESS, (HW_REG_READ(SYSCTL_RCC2_REG_ADDRESS) & ~MCU_RCC2_SYSDIV_MASK)
+                                          | MCU_RCC2_DIV400 | ((uint32)MCU_PLL_SYSDIV << MCU_RCC2_SYSDIV_POS));
+
+    /*Wait for the PLL to lock*/
+    while((!(HW_REG_READ(SYSCTL_RIS_REG_ADDRESS) & MCU_RIS_PLLLRIS)) && (lockTimeout > 0U))
+    {
+        lockTimeout--;
+    }
+
+    if(HW_REG_READ(SYSCTL_RIS_REG_ADDRESS) & MCU_RIS_PLLLRIS)
+    {
+        /*Feed the core from the PLL*/
+        HW_REG_CLEAR_BITS(SYSCTL_RCC2_REG_ADDRESS, MCU_RCC2_BYPASS2);
+        Mcu_CoreClockHz = MCU_PLL_CLOCK_HZ / (MCU_PLL_SYSDIV + 1U);
+        Mcu_PllStatus   = MCU_PLL_LOCKED;
+    }
+    else
+    {
+        /*Give the PIOSC back to the core and power the PLL down*/
+        HW_REG_SET_BITS(SYSCTL_RCC2_REG_ADDRESS, MCU_RCC2_PWRDN2);
+        HW_REG_WRITE(SYSCTL_RCC2_REG_ADDRESS, (HW_REG_READ(SYSCTL_RCC2_REG_ADDRESS) & ~MCU_RCC2_OSCSRC2_MASK) | MCU_RCC2_OSCSRC2_PIOSC);
+        Mcu_PllStatus = MCU_PLL_UNLOCKED;
+        status = E_NOT_OK;
+    }
+#endif
+    return status;
 }
 
+uint32 Mcu_GetCoreClockFrequency(void)
+{
+    return Mcu_CoreClockHz;
+}
 
+Mcu_PllStatusType Mcu_GetPllStatus(void)
+{
+    return Mcu_PllStatus;
+}
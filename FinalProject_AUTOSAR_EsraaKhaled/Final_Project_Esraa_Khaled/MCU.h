@@ -9,8 +9,48 @@
 #define MCU_H_
 
 #include "Std_Types.h"
+#include "Mcu_Cfg.h"
+
+/* GPIO Ports base addresses on the aperture selected by MCU_GPIO_AHB_APERTURE */
+#if (MCU_GPIO_AHB_APERTURE == STD_ON)
+#define MCU_GPIO_PORTA_BASE_ADDRESS     GPIO_PORTA_AHB_BASE_ADDRESS
+#define MCU_GPIO_PORTB_BASE_ADDRESS     GPIO_PORTB_AHB_BASE_ADDRESS
+#define MCU_GPIO_PORTC_BASE_ADDRESS     GPIO_PORTC_AHB_BASE_ADDRESS
+#define MCU_GPIO_PORTD_BASE_ADDRESS     GPIO_PORTD_AHB_BASE_ADDRESS
+#define MCU_GPIO_PORTE_BASE_ADDRESS     GPIO_PORTE_AHB_BASE_ADDRESS
+#define MCU_GPIO_PORTF_BASE_ADDRESS     GPIO_PORTF_AHB_BASE_ADDRESS
+#else
+#define MCU_GPIO_PORTA_BASE_ADDRESS     GPIO_PORTA_BASE_ADDRESS
+#define MCU_GPIO_PORTB_BASE_ADDRESS     GPIO_PORTB_BASE_ADDRESS
+#define MCU_GPIO_PORTC_BASE_ADDRESS     GPIO_PORTC_BASE_ADDRESS
+#define MCU_GPIO_PORTD_BASE_ADDRESS     GPIO_PORTD_BASE_ADDRESS
+#define MCU_GPIO_PORTE_BASE_ADDRESS     GPIO_PORTE_BASE_ADDRESS
+#define MCU_GPIO_PORTF_BASE_ADDRESS     GPIO_PORTF_BASE_ADDRESS
+#endif
+
+/* Status of the PLL after Mcu_InitClock */
+typedef enum
+{
+    MCU_PLL_LOCKED,
+    MCU_PLL_UNLOCKED,
+    MCU_PLL_STATUS_UNDEFINED
+}Mcu_PllStatusType;
 
 /*Function Prototypes*/
-void Mcu_Init(void);
+
+/* Enable the clocks of the ports used by the Port configuration, called from ResetISR before the C runtime initialization */
+void Mcu_StartPortClocks(void);
+
+/* Start the port clocks if not yet started and wait for the ports to be ready, E_NOT_OK if they are not ready in time */
+Std_ReturnType Mcu_Init(void);
+
+/* Switch the system clock to the PLL configured in Mcu_Cfg.h, E_NOT_OK if the PLL does not lock (the core stays on the PIOSC) */
+Std_ReturnType Mcu_InitClock(void);
+
+/* Frequency of the core clock in Hz, used by the timing drivers to scale their counts */
+uint32 Mcu_GetCoreClockFrequency(void);
+
+/* Result of the last Mcu_InitClock, MCU_PLL_UNLOCKED when the core fell back to the PIOSC, undefined before the first call or with MCU_PLL_ENABLE off */
+Mcu_PllStatusType Mcu_GetPllStatus(void);
 
 #endif /* MCU_H_ */
@@ -0,0 +1,43 @@
+/*
+ * Module: MCU
+ * File Name: Mcu_Cfg.h
+ * Description: Pre-Compile Configuration Header File for TM4C123GH6PM Microcontroller - Mcu Driver
+ * Author: Esraa Khaled
+ */
+
+#ifndef MCU_CFG_H_
+#define MCU_CFG_H_
+
+/*
+ * Pre-Compile Option for the GPIO bus aperture:
+ * STD_ON  --> Mcu_Init moves all GPIO ports to the AHB aperture (0x40058000...) and Port/Dio use the AHB base addresses
+ * STD_OFF --> Ports stay on the legacy APB aperture (0x40004000...)
+ */
+#define MCU_GPIO_AHB_APERTURE                 (STD_ON)
+
+/* Mask of all GPIO ports (PORTA --> PORTF) in SYSCTL GPIO registers */
+#define MCU_GPIO_ALL_PORTS_MASK               (0x3FU)
+
+/*
+ * Number of PRGPIO polls before Mcu_Init gives up waiting for the clocked ports to be ready.
+ * A port is ready a few system clocks after its RCGCGPIO bit is set.
+ */
+#define MCU_GPIO_READY_TIMEOUT                (100U)
+
+/*
+ * Pre-Compile Option for the system clock applied by Mcu_InitClock:
+ * STD_ON  --> the main oscillator drives the 400 MHz PLL and the core runs at 400 MHz / (MCU_PLL_SYSDIV + 1)
+ * STD_OFF --> the core keeps running from the 16 MHz PIOSC
+ */
+#define MCU_PLL_ENABLE                        (STD_ON)
+
+/* XTAL field of SYSCTL RCC register: 0x15 --> 16 MHz crystal of the LaunchPad */
+#define MCU_PLL_XTAL                          (0x15U)
+
+/* 7-bit SYSDIV2:SYSDIV2LSB divider of the PLL output, 4 --> 80 MHz (the maximum core frequency) */
+#define MCU_PLL_SYSDIV                        (4U)
+
+/* Number of SYSCTL RIS polls before Mcu_InitClock gives up waiting for the PLL lock and stays on the PIOSC */
+#define MCU_PLL_LOCK_TIMEOUT                  (100000U)
+
+#endif /* MCU_CFG_H_ */
@@ -6,13 +6,27 @@
  */
 
 
-#include "Os.h"
+#include "OS.h"
 #include "App.h"
 #include "Gpt.h"
 #include "Button.h"
 #include "Led.h"
+#include "Dio.h"
+#include "tm4c123gh6pm_registers.h"
 
 
+#ifdef HOST_SIMULATION
+#include "Sim_Registers.h"
+
+/* On the host the PRIMASK is modeled by masking the simulated SysTick interrupt, faults are not modeled */
+#define Enable_Exceptions()    Sim_EnableInterrupts()
+#define Disable_Exceptions()   Sim_DisableInterrupts()
+#define Enable_Faults()
+#define Disable_Faults()
+#define Wait_For_Interrupt()   Sim_WaitForInterrupt()
+
+#else
+
 /* Enable Exceptions ... This Macro enable IRQ interrupts, Programmable Systems Exceptions and Faults by clearing the I-bit in the PRIMASK. */
 #define Enable_Exceptions()    __asm(" CPSIE I ")
 
@@ -25,15 +39,220 @@
 /* Disable Faults ... This Macro disable Faults by setting the F-bit in the FAULTMASK */
 #define Disable_Faults()       __asm(" CPSID F ")
 
-/* Global variable store the Os Time */
-static uint8 g_Time_Tick_Count = 0;
+/* Wait For Interrupt ... This Macro sleeps until an interrupt is pending, even a masked one wakes up the CPU */
+#define Wait_For_Interrupt()   __asm(" WFI ")
+
+#endif
+
+#define OS_TASK_CONFIG(ARG,TASK,PERIOD,OFFSET,PRIORITY,POLICY)    {TASK, PERIOD, OFFSET, PRIORITY, POLICY},
+#define OS_TASK_VALID(ARG,TASK,PERIOD,OFFSET,PRIORITY,POLICY)     && (((PERIOD) % OS_BASE_TIME) == 0U) && ((OS_HYPERPERIOD % (PERIOD)) == 0U)\
+                                                                  && (((OFFSET) % OS_BASE_TIME) == 0U) && ((OFFSET) < (PERIOD))\
+                                                                  && (((POLICY) == OS_TASK_CATCH_UP) || ((POLICY) == OS_TASK_SKIP))
+
+/*
+ * Every task closes the comparison with the previous task and opens the one with the next task,
+ * the list expands to (0xFF >= P1) && (P1 >= P2) && ... && (Pn >= 0)
+ */
+#define OS_TASK_PRIORITY_ORDER(ARG,TASK,PERIOD,OFFSET,PRIORITY,POLICY)    (int)(PRIORITY)) && ((int)(PRIORITY) >=
+
+/* A compile error here means that a task of OS_TASKS_LIST does not fit the base time or the hyperperiod or has an invalid policy */
+typedef uint8 Os_TasksCheck[((OS_HYPERPERIOD % OS_BASE_TIME) == 0U) OS_TASKS_LIST(OS_TASK_VALID, 0) ? 1 : -1];
+
+/* A compile error here means that OS_TASKS_LIST has more than 32 tasks or is not sorted from the highest priority */
+typedef uint8 Os_TasksOrderCheck[((OS_TASKS_COUNT <= 32U) && ((0xFF >= OS_TASKS_LIST(OS_TASK_PRIORITY_ORDER, 0) 0))) ? 1 : -1];
+
+#if ((OS_IDLE_MODE != OS_IDLE_POLLING) && (OS_IDLE_MODE != OS_IDLE_WFI) && (OS_IDLE_MODE != OS_IDLE_TICKLESS))
+#error "OS_IDLE_MODE must be OS_IDLE_POLLING, OS_IDLE_WFI or OS_IDLE_TICKLESS"
+#endif
+
+#if ((OS_IDLE_MODE == OS_IDLE_TICKLESS) && ((OS_TICKLESS_MAX_TICKS < 1U) || (OS_TICKLESS_MAX_TICKS > 16U)))
+#error "OS_TICKLESS_MAX_TICKS must be 1 --> 16"
+#endif
+
+/*
+ * Schedule table builder:
+ * the tasks due at every expiry point and the delay to the next point are computed at compile time from OS_TASKS_LIST
+ */
+#define OS_DUE_TASK(TIME,TASK,PERIOD,OFFSET,PRIORITY,POLICY)      | (((((TIME) % OS_HYPERPERIOD) % (PERIOD)) == (OFFSET)) ? (1UL << OsConf_##TASK##_ID) : 0UL)
+#define OS_DUE_TASKS(TIME)                                        (0UL OS_TASKS_LIST(OS_DUE_TASK, TIME))
+
+#if (OS_IDLE_MODE == OS_IDLE_TICKLESS)
+/* Tickless: skip the points without due tasks, up to OS_TICKLESS_MAX_TICKS at once */
+#define OS_DELAY_STEP(TIME,DELAY,NEXT)\
+    ((((DELAY) >= OS_TICKLESS_MAX_TICKS) || (OS_DUE_TASKS((TIME) + ((DELAY) * OS_BASE_TIME)) != 0UL)) ? (DELAY) : (NEXT))
+#define OS_NEXT_DELAY(TIME)\
+    OS_DELAY_STEP(TIME, 1U, OS_DELAY_STEP(TIME, 2U, OS_DELAY_STEP(TIME, 3U, OS_DELAY_STEP(TIME, 4U,\
+    OS_DELAY_STEP(TIME, 5U, OS_DELAY_STEP(TIME, 6U, OS_DELAY_STEP(TIME, 7U, OS_DELAY_STEP(TIME, 8U,\
+    OS_DELAY_STEP(TIME, 9U, OS_DELAY_STEP(TIME, 10U, OS_DELAY_STEP(TIME, 11U, OS_DELAY_STEP(TIME, 12U,\
+    OS_DELAY_STEP(TIME, 13U, OS_DELAY_STEP(TIME, 14U, OS_DELAY_STEP(TIME, 15U, 16U)))))))))))))))
+#else
+#define OS_NEXT_DELAY(TIME)                                       (1U)
+#endif
+
+#define OS_EXPIRY_POINT(TIME)                                     {OS_DUE_TASKS(TIME), OS_NEXT_DELAY(TIME)},
+
+/* The points are multiples of OS_BASE_TIME listed in increasing order: (-1 < T1) && (T1 < T2) && ... && (Tn < OS_HYPERPERIOD) */
+#define OS_POINT_COUNT_ONE(TIME)                                  + 1U
+#define OS_POINT_VALID(TIME)                                      && (((TIME) % OS_BASE_TIME) == 0U)
+#define OS_POINT_ORDER(TIME)                                      (long)(TIME)) && ((long)(TIME) <
+
+/* A compile error here means that OS_EXPIRY_POINTS_LIST does not list every tick of the hyperperiod once and in order */
+typedef uint8 Os_ExpiryPointsCheck[((0U OS_EXPIRY_POINTS_LIST(OS_POINT_COUNT_ONE)) == OS_EXPIRY_POINTS)
+                                   OS_EXPIRY_POINTS_LIST(OS_POINT_VALID)
+                                   && ((-1L < OS_EXPIRY_POINTS_LIST(OS_POINT_ORDER) (long)OS_HYPERPERIOD)) ? 1 : -1];
+
+/* Task table */
+STATIC const Os_TaskConfigType Os_Tasks[OS_TASKS_COUNT] =
+{
+    OS_TASKS_LIST(OS_TASK_CONFIG, 0)
+};
+
+/* Schedule table: one expiry point per tick of the hyperperiod with the tasks due at that point */
+STATIC const Os_ExpiryPointType Os_ExpiryPoints[OS_EXPIRY_POINTS] =
+{
+    OS_EXPIRY_POINTS_LIST(OS_EXPIRY_POINT)
+};
+
+/* Index of the lowest set bit of a due tasks mask, looked up from the de Bruijn product of the isolated bit */
+STATIC const uint8 Os_DueTaskIndex[32] =
+{
+    0U, 1U, 28U, 2U, 29U, 14U, 24U, 3U, 30U, 22U, 20U, 15U, 25U, 17U, 4U, 8U,
+    31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U, 26U, 12U, 18U, 6U, 11U, 5U, 10U, 9U
+};
+#define OS_LOWEST_DUE_TASK(MASK)                                  Os_DueTaskIndex[(((MASK) & (0UL - (MASK))) * 0x077CB531UL) >> 27]
+
+/* Global variable store the number of ticks since the OS timer started */
+static volatile uint32 g_Time_Tick_Count = 0;
+
+/* Global variable store the number of ticks not yet processed by the scheduler */
+static volatile uint32 g_Pending_Ticks = 0;
+
+/* Expiry point of the last tick processed by the scheduler */
+STATIC uint16 Os_ExpiryPointIndex = 0U;
+
+/* Expiry point reached at the last SysTick interrupt */
+STATIC uint16 Os_TimerPointIndex = 0U;
+
+/* Longest delay between two expiry points in ticks */
+#if (OS_IDLE_MODE == OS_IDLE_TICKLESS)
+#define OS_TIMER_MAX_DELAY              (OS_TICKLESS_MAX_TICKS)
+#else
+#define OS_TIMER_MAX_DELAY              (1U)
+#endif
+
+/* SysTick Reload value of every delay between two expiry points (1 --> OS_TIMER_MAX_DELAY ticks), converted by Os_start */
+STATIC uint32 Os_TimerReloads[OS_TIMER_MAX_DELAY];
+
+/* Ticks not finished before the next tick arrived and late activations of every task */
+STATIC uint32 Os_TickOverrunCount = 0U;
+STATIC uint32 Os_TaskOverrunCount[OS_TASKS_COUNT];
+
+#if (OS_TASK_PROFILING == STD_ON)
 
-/* Global variable to indicate the the timer has a new tick */
-static uint8 g_New_Time_Tick_Flag = 0;
+/* TRCENA bit in DEMCR enables the DWT unit and CYCCNTENA bit in DWT_CTRL starts the cycle counter */
+#define OS_DEMCR_TRCENA                 (0x01000000UL)
+#define OS_DWT_CTRL_CYCCNTENA           (0x00000001UL)
+
+/* Accumulated measurements of a task, the averages are computed when the statistics are read */
+typedef struct
+{
+    uint32 Activations;
+    uint32 Min_Execution_Cycles;
+    uint32 Max_Execution_Cycles;
+    uint64 Total_Execution_Cycles;
+    uint32 Min_Release_Jitter_Cycles;
+    uint32 Max_Release_Jitter_Cycles;
+    uint64 Total_Release_Jitter_Cycles;
+}Os_TaskProfileType;
+
+STATIC Os_TaskProfileType Os_TaskProfiles[OS_TASKS_COUNT];
+
+/* CYCCNT at the last SysTick interrupt */
+static volatile uint32 g_Tick_Release_Cycles = 0;
+
+#endif
+
+/*********************************************************************************************/
+/* Description: Expiry point processed after the point PointIndex */
+STATIC uint16 Os_NextExpiryPoint(uint16 PointIndex)
+{
+    uint16 nextIndex = PointIndex + Os_ExpiryPoints[PointIndex].Next_Delay;
+    return (nextIndex >= OS_EXPIRY_POINTS) ? (uint16)(nextIndex - OS_EXPIRY_POINTS) : nextIndex;
+}
+
+/*********************************************************************************************/
+/* Description: Convert every delay between two expiry points to its Reload value at the core clock set by the Init Task */
+STATIC Std_ReturnType Os_ComputeTimerReloads(void)
+{
+    Std_ReturnType status = E_OK;
+    uint16 delay;
+
+    for(delay = 1U; (delay <= OS_TIMER_MAX_DELAY) && (E_OK == status); delay++)
+    {
+        status = SysTick_ComputeReload(delay * OS_BASE_TIME_US, &Os_TimerReloads[delay - 1U]);
+    }
+    return status;
+}
+
+#if (OS_TASK_PROFILING == STD_ON)
+/*********************************************************************************************/
+/* Description: Start the DWT cycle counter and reset the statistics of all the tasks */
+STATIC void Os_StartProfiling(void)
+{
+    uint8 taskIndex;
+
+    HW_REG_SET_BITS(CORE_DEBUG_DEMCR_REG_ADDRESS, OS_DEMCR_TRCENA);
+    HW_REG_WRITE(DWT_CYCCNT_REG_ADDRESS, 0U);
+    HW_REG_SET_BITS(DWT_CTRL_REG_ADDRESS, OS_DWT_CTRL_CYCCNTENA);
+
+    for(taskIndex = 0U; taskIndex < OS_TASKS_COUNT; taskIndex++)
+    {
+        Os_TaskProfiles[taskIndex].Activations                 = 0U;
+        Os_TaskProfiles[taskIndex].Min_Execution_Cycles        = 0xFFFFFFFFUL;
+        Os_TaskProfiles[taskIndex].Max_Execution_Cycles        = 0U;
+        Os_TaskProfiles[taskIndex].Total_Execution_Cycles      = 0U;
+        Os_TaskProfiles[taskIndex].Min_Release_Jitter_Cycles   = 0xFFFFFFFFUL;
+        Os_TaskProfiles[taskIndex].Max_Release_Jitter_Cycles   = 0U;
+        Os_TaskProfiles[taskIndex].Total_Release_Jitter_Cycles = 0U;
+    }
+}
+
+/*********************************************************************************************/
+/* Description: Account one activation of the task, CYCCNT wraps are handled by the unsigned differences */
+STATIC void Os_ProfileTask(uint8 TaskIndex, uint32 ReleaseCycles, uint32 StartCycles, uint32 EndCycles)
+{
+    Os_TaskProfileType *profile = &Os_TaskProfiles[TaskIndex];
+    uint32 executionCycles = EndCycles - StartCycles;
+    uint32 jitterCycles    = StartCycles - ReleaseCycles;
+
+    profile->Activations++;
+    profile->Total_Execution_Cycles      += executionCycles;
+    profile->Total_Release_Jitter_Cycles += jitterCycles;
+
+    if(executionCycles < profile->Min_Execution_Cycles)
+    {
+        profile->Min_Execution_Cycles = executionCycles;
+    }
+    if(executionCycles > profile->Max_Execution_Cycles)
+    {
+        profile->Max_Execution_Cycles = executionCycles;
+    }
+    if(jitterCycles < profile->Min_Release_Jitter_Cycles)
+    {
+        profile->Min_Release_Jitter_Cycles = jitterCycles;
+    }
+    if(jitterCycles > profile->Max_Release_Jitter_Cycles)
+    {
+        profile->Max_Release_Jitter_Cycles = jitterCycles;
+    }
+}
+#endif
 
 /*********************************************************************************************/
-void Os_start(void)
+Std_ReturnType Os_start(void)
 {
+    Std_ReturnType status;
+
     /* Global Interrupts Enable */
     Enable_Exceptions();
 
@@ -43,60 +262,266 @@ void Os_start(void)
      */
     SysTick_SetCallBack(Os_NewTimerTick);
 
-    /* Start SysTickTimer to generate interrupt every 20ms */
-    SysTick_Start(OS_BASE_TIME);
+    /* Execute the Init Task, it sets the core clock that SysTick_Start scales its reload value from */
+    status = Init_Task();
 
-    /* Execute the Init Task */
-    Init_Task();
+    /*
+     * The tasks access the ports, neither the OS timer nor the Os Scheduler are started when the MCAL is not initialized.
+     * The periods between the expiry points are converted once here, the timer interrupt only writes their Reload values.
+     */
+    if(E_OK == status)
+    {
+        status = Os_ComputeTimerReloads();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if(E_OK == status)
+    {
+#if (OS_TASK_PROFILING == STD_ON)
+        /* Start the cycle counter before the first tick */
+        Os_StartProfiling();
+#endif
 
-    /* Start the Os Scheduler */
-    Os_Scheduler();
+#if (OS_IDLE_MODE == OS_IDLE_TICKLESS)
+        /* Start SysTickTimer up to the first expiry point with due tasks */
+        status = SysTick_Start(Os_ExpiryPoints[0].Next_Delay * OS_BASE_TIME_US);
+#else
+        /* Start SysTickTimer to generate interrupt every 20ms */
+        status = SysTick_Start(OS_BASE_TIME_US);
+#endif
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+#if (OS_IDLE_MODE == OS_IDLE_TICKLESS)
+    if(E_OK == status)
+    {
+        /* Queue the period of the interval after the first expiry point, loaded by the HW at the first wrap */
+        HW_REG_WRITE(SYSTICK_RELOAD_REG_ADDRESS, Os_TimerReloads[Os_ExpiryPoints[Os_NextExpiryPoint(0U)].Next_Delay - 1U]);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+
+    /* Start the Os Scheduler, without a tick when the base time does not fit the SysTick at the current core clock */
+    if(E_OK == status)
+    {
+        Os_Scheduler();
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return status;
 }
 
 /*********************************************************************************************/
 void Os_NewTimerTick(void)
 {
-    /* Increment the Os time by OS_BASE_TIME */
-    g_Time_Tick_Count   += OS_BASE_TIME;
+#if (OS_TASK_PROFILING == STD_ON)
+    /* Release time of the tasks of this tick */
+    g_Tick_Release_Cycles = HW_REG_READ(DWT_CYCCNT_REG_ADDRESS);
+#endif
+
+    /* Increment the Os time by the ticks of the period that just ended, one tick of OS_BASE_TIME unless tickless */
+    g_Time_Tick_Count += Os_ExpiryPoints[Os_TimerPointIndex].Next_Delay;
+    Os_TimerPointIndex = Os_NextExpiryPoint(Os_TimerPointIndex);
+
+#if (OS_IDLE_MODE == OS_IDLE_TICKLESS)
+    /* SysTick already counts the period ending at the next expiry point, queue the precomputed Reload of the one after it */
+    HW_REG_WRITE(SYSTICK_RELOAD_REG_ADDRESS, Os_TimerReloads[Os_ExpiryPoints[Os_NextExpiryPoint(Os_TimerPointIndex)].Next_Delay - 1U]);
+#endif
+
+    /* Queue the tick, the ticks that arrive while the tasks overrun are processed one by one and never merged */
+    g_Pending_Ticks++;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetTickCount(void)
+{
+    return g_Time_Tick_Count;
+}
 
-    /* Set the flag to 1 to indicate that there is a new timer tick */
-    g_New_Time_Tick_Flag = 1;
+/*********************************************************************************************/
+uint32 Os_GetTickOverrunCount(void)
+{
+    return Os_TickOverrunCount;
+}
+
+/*********************************************************************************************/
+uint32 Os_GetTaskOverrunCount(Os_TaskIdType TaskId)
+{
+    return (TaskId < OS_TASKS_COUNT) ? Os_TaskOverrunCount[TaskId] : 0U;
+}
+
+#if (OS_TASK_PROFILING == STD_ON)
+/*********************************************************************************************/
+Std_ReturnType Os_GetTaskStatistics(Os_TaskIdType TaskId, Os_TaskStatisticsType *Statistics)
+{
+    const Os_TaskProfileType *profile;
+    Std_ReturnType status = E_NOT_OK;
+
+    if((TaskId < OS_TASKS_COUNT) && (Statistics != NULL_PTR))
+    {
+        profile = &Os_TaskProfiles[TaskId];
+        Statistics->Activations = profile->Activations;
+        if(profile->Activations != 0U)
+        {
+            Statistics->Min_Execution_Cycles      = profile->Min_Execution_Cycles;
+            Statistics->Max_Execution_Cycles      = profile->Max_Execution_Cycles;
+            Statistics->Avg_Execution_Cycles      = (uint32)(profile->Total_Execution_Cycles / profile->Activations);
+            Statistics->Min_Release_Jitter_Cycles = profile->Min_Release_Jitter_Cycles;
+            Statistics->Max_Release_Jitter_Cycles = profile->Max_Release_Jitter_Cycles;
+            Statistics->Avg_Release_Jitter_Cycles = (uint32)(profile->Total_Release_Jitter_Cycles / profile->Activations);
+        }
+        else
+        {
+            Statistics->Min_Execution_Cycles      = 0U;
+            Statistics->Max_Execution_Cycles      = 0U;
+            Statistics->Avg_Execution_Cycles      = 0U;
+            Statistics->Min_Release_Jitter_Cycles = 0U;
+            Statistics->Max_Release_Jitter_Cycles = 0U;
+            Statistics->Avg_Release_Jitter_Cycles = 0U;
+        }
+        status = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    return status;
 }
+#endif
 
 /*********************************************************************************************/
 void Os_Scheduler(void)
 {
+    uint32 dueTasks;
+    uint8 taskIndex;
+    uint32 lateTicks;
+    boolean tickLate;
+    boolean tickOverrun = FALSE;
+#if (OS_TASK_PROFILING == STD_ON)
+    uint32 lateIndex;
+    uint16 pointIndex;
+    uint32 releaseCycles;
+    uint32 startCycles;
+#endif
+
     while(1)
     {
     /* Code is only executed in case there is a new timer tick */
-    if(g_New_Time_Tick_Flag == 1)
+    if(g_Pending_Ticks != 0U)
     {
-        switch(g_Time_Tick_Count)
+        /* Take the oldest pending tick, it is late if newer ticks are already pending behind it */
+        Disable_Exceptions();
+        g_Pending_Ticks--;
+        lateTicks = g_Pending_Ticks;
+#if (OS_TASK_PROFILING == STD_ON)
+        releaseCycles = g_Tick_Release_Cycles;
+#endif
+        Enable_Exceptions();
+
+        /* The schedule table restarts every hyperperiod */
+        Os_ExpiryPointIndex = Os_NextExpiryPoint(Os_ExpiryPointIndex);
+
+#if (OS_TASK_PROFILING == STD_ON)
+        /*
+         * Release of this expiry point: the last interrupt minus the SysTick periods of the late points behind it,
+         * every period is Reload + 1 cycles of the Reload programmed for the Next_Delay of its point
+         */
+        pointIndex = Os_ExpiryPointIndex;
+        for(lateIndex = 0U; lateIndex < lateTicks; lateIndex++)
+        {
+            releaseCycles -= Os_TimerReloads[Os_ExpiryPoints[pointIndex].Next_Delay - 1U] + 1U;
+            pointIndex = Os_NextExpiryPoint(pointIndex);
+        }
+#endif
+
+        /* The activations of this tick are late if newer ticks are pending or if the previous tick overran into its window */
+        if((lateTicks != 0U) || (tickOverrun == TRUE))
+        {
+            tickLate = TRUE;
+        }
+        else
+        {
+            tickLate = FALSE;
+        }
+
+        /* Run only the tasks due at this tick, highest priority first (lowest ID), a late tick runs only the catch-up tasks */
+        dueTasks = Os_ExpiryPoints[Os_ExpiryPointIndex].Due_Tasks;
+        while(dueTasks != 0U)
+        {
+            taskIndex = OS_LOWEST_DUE_TASK(dueTasks);
+            dueTasks &= dueTasks - 1U;
+            if(tickLate == TRUE)
+            {
+                Os_TaskOverrunCount[taskIndex]++;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            if((lateTicks == 0U) || (Os_Tasks[taskIndex].Policy == OS_TASK_CATCH_UP))
+            {
+#if (OS_TASK_PROFILING == STD_ON)
+                startCycles = HW_REG_READ(DWT_CYCCNT_REG_ADDRESS);
+                Os_Tasks[taskIndex].Task();
+                Os_ProfileTask(taskIndex, releaseCycles, startCycles, HW_REG_READ(DWT_CYCCNT_REG_ADDRESS));
+#else
+                Os_Tasks[taskIndex].Task();
+#endif
+            }
+            else
             {
-        case 20:
-        case 100:
-                Button_Task();
-                g_New_Time_Tick_Flag = 0;
-                break;
-        case 40:
-        case 80:
-                Button_Task();
-                Led_Task();
-                g_New_Time_Tick_Flag = 0;
-                break;
-        case 60:
-                Button_Task();
-                App_Task();
-                g_New_Time_Tick_Flag = 0;
-                break;
-        case 120:
-                Button_Task();
-                App_Task();
-                Led_Task();
-                g_New_Time_Tick_Flag = 0;
-                g_Time_Tick_Count = 0;
-                break;
+                /* Do Nothing */
             }
+        }
+
+#if (DIO_OUTPUT_IMAGE_API == STD_ON)
+        /* Flush the Dio output image once the tasks of this tick are executed */
+        Dio_Commit();
+#endif
+
+        /* The tick overran if the next tick arrived before its tasks finished */
+        Disable_Exceptions();
+        if(g_Pending_Ticks != 0U)
+        {
+            tickOverrun = TRUE;
+        }
+        else
+        {
+            tickOverrun = FALSE;
+        }
+        Enable_Exceptions();
+        if(tickOverrun == TRUE)
+        {
+            Os_TickOverrunCount++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+#if (OS_IDLE_MODE != OS_IDLE_POLLING)
+        /* Sleep until the next tick, checked with the interrupts masked so a tick arriving in between still wakes up the WFI */
+        Disable_Exceptions();
+        if(g_Pending_Ticks == 0U)
+        {
+            Wait_For_Interrupt();
+        }
+        Enable_Exceptions();
+#endif
     }
     }
 
@@ -10,23 +10,93 @@
 
 
 #include "Std_Types.h"
+#include "Os_Cfg.h"
 
-/* Timer counting time in ms */
-#define OS_BASE_TIME 20
+/* Idle modes of the scheduler */
+#define OS_IDLE_POLLING                 (0U)
+#define OS_IDLE_WFI                     (1U)
+#define OS_IDLE_TICKLESS                (2U)
+
+/* Policies of the late activations of a task */
+#define OS_TASK_CATCH_UP                (0U)
+#define OS_TASK_SKIP                    (1U)
+
+/* Task IDs in the order of OS_TASKS_LIST: OsConf_<TASK>_ID */
+#define OS_TASK_ID(ARG,TASK,PERIOD,OFFSET,PRIORITY,POLICY)    OsConf_##TASK##_ID,
+typedef enum
+{
+    OS_TASKS_LIST(OS_TASK_ID, 0)
+    OS_INVALID_TASK_ID
+}Os_TaskIdType;
+
+/* Periodic task entry point */
+typedef void (*Os_TaskFunctionType)(void);
+
+/* Entry of the task table built from OS_TASKS_LIST */
+typedef struct
+{
+    Os_TaskFunctionType Task;
+    uint16 Period;
+    uint16 Offset;
+    uint8 Priority;
+    uint8 Policy;
+}Os_TaskConfigType;
+
+/*
+ * Profiling statistics of a task in core clock cycles (DWT CYCCNT):
+ * - Execution: from the start to the end of the task, the maximum is the measured WCET
+ * - Release jitter: from the SysTick interrupt of the tick to the start of the task
+ */
+typedef struct
+{
+    uint32 Activations;
+    uint32 Min_Execution_Cycles;
+    uint32 Max_Execution_Cycles;
+    uint32 Avg_Execution_Cycles;
+    uint32 Min_Release_Jitter_Cycles;
+    uint32 Max_Release_Jitter_Cycles;
+    uint32 Avg_Release_Jitter_Cycles;
+}Os_TaskStatisticsType;
+
+/*
+ * Expiry point of the schedule table: the tasks due at this tick (bit n for the task ID n)
+ * and the delay in ticks to the next expiry point processed after it (1 unless the idle mode is tickless)
+ */
+typedef struct
+{
+    uint32 Due_Tasks;
+    uint16 Next_Delay;
+}Os_ExpiryPointType;
 
 /* Description:
  * Function responsible for:
  * 1. Enable Interrupts
- * 2. Start the OS timer
- * 3. Execute the Init Task
+ * 2. Execute the Init Task
+ * 3. Start the OS timer
  * 4. Start the Scheduler to run the tasks
+ * It returns E_NOT_OK only when the Init Task failed or the OS timer cannot count OS_BASE_TIME at the current core clock,
+ * no task has been run then
  */
-void Os_start(void);
+Std_ReturnType Os_start(void);
 
-/* Description: The Engine of the Os Scheduler used for switch between different tasks */
+/* Description: The Engine of the Os Scheduler, runs the tasks of the expiry point of every new tick */
 void Os_Scheduler(void);
 
 /* Description: Function called by the Timer Driver in the MCAL layer using the call back pointer */
 void Os_NewTimerTick(void);
 
+/* Description: Number of ticks since the OS timer started, it wraps after 2^32 ticks (updated at the expiry points in tickless mode) */
+uint32 Os_GetTickCount(void);
+
+/* Description: Number of ticks whose tasks did not finish before the next tick arrived (a tick pending behind an overrun counts too) */
+uint32 Os_GetTickOverrunCount(void);
+
+/* Description: Number of late activations of the task (released while an earlier tick overran, run late or skipped by its policy), 0 for an invalid ID */
+uint32 Os_GetTaskOverrunCount(Os_TaskIdType TaskId);
+
+#if (OS_TASK_PROFILING == STD_ON)
+/* Description: Copy the profiling statistics of the task, E_NOT_OK for an invalid ID or a NULL_PTR */
+Std_ReturnType Os_GetTaskStatistics(Os_TaskIdType TaskId, Os_TaskStatisticsType *Statistics);
+#endif
+
 #endif /* OS_H_ */
@@ -0,0 +1,71 @@
+/*
+ * Module: Operating System
+ * File Name: Os_Cfg.h
+ * Description: Header file for Pre-Compiler configuration used by OS Scheduler
+ * Author: Esraa Khaled
+ */
+
+#ifndef OS_CFG_H_
+#define OS_CFG_H_
+
+/* Timer counting time in ms */
+#define OS_BASE_TIME                    (20U)
+
+/* OS_BASE_TIME in micro-seconds as programmed in the SysTick */
+#define OS_BASE_TIME_US                 (OS_BASE_TIME * 1000UL)
+
+/* Least common multiple of the task periods in ms, the schedule table repeats every hyperperiod */
+#define OS_HYPERPERIOD                  (120U)
+
+/*
+ * Pre-Compile Option for the task profiling:
+ * STD_ON  --> every task dispatch is bracketed by DWT CYCCNT reads to collect its execution time and release jitter
+ * STD_OFF --> no profiling hooks in the scheduler
+ */
+#define OS_TASK_PROFILING               (STD_ON)
+
+/*
+ * Pre-Compile Option for the idle time of the scheduler when no tick is pending:
+ * OS_IDLE_POLLING  --> busy loop polling the pending ticks
+ * OS_IDLE_WFI      --> sleep in WFI until the next SysTick interrupt
+ * OS_IDLE_TICKLESS --> sleep in WFI and program SysTick up to the next expiry point with due tasks
+ *                      instead of interrupting every OS_BASE_TIME
+ */
+#define OS_IDLE_MODE                    (OS_IDLE_TICKLESS)
+
+/* Longest SysTick period of the tickless mode in ticks, OS_TICKLESS_MAX_TICKS * OS_BASE_TIME must fit the 24-bit reload (209 ms at 80 MHz) */
+#define OS_TICKLESS_MAX_TICKS           (8U)
+
+/*
+ * Periodic tasks of the schedule table (at most 32):
+ * ENTRY(ARG, TASK, PERIOD, OFFSET, PRIORITY, POLICY), ARG is passed through for the schedule table builders of OS.c
+ * - PERIOD and OFFSET are in ms, multiples of OS_BASE_TIME, PERIOD divides OS_HYPERPERIOD and OFFSET < PERIOD
+ * - The task is activated at the ticks where (time % PERIOD) == OFFSET
+ * - The tasks are listed from the highest PRIORITY (checked at compile time),
+ *   tasks due at the same tick run in the list order
+ * - POLICY for the activations of the ticks that are late because the previous ticks overran:
+ *   OS_TASK_CATCH_UP runs them back to back, OS_TASK_SKIP drops them and runs at the next due tick on time
+ *   Both count them in the overrun counter of the task, with the activations of the tick right after an overrun
+ */
+#define OS_TASKS_LIST(ENTRY,ARG) \
+    ENTRY(ARG, Button_Task, 20U, 0U, 3U, OS_TASK_SKIP) \
+    ENTRY(ARG, App_Task,    60U, 0U, 2U, OS_TASK_CATCH_UP) \
+    ENTRY(ARG, Led_Task,    40U, 0U, 1U, OS_TASK_SKIP)
+
+/*
+ * Expiry points of the schedule table, one per tick of the hyperperiod: POINT(TIME) with TIME in ms
+ * from 0 to OS_HYPERPERIOD - OS_BASE_TIME (checked at compile time).
+ * The tasks due at every point and the delay to the next point are generated from OS_TASKS_LIST in OS.c
+ */
+#define OS_EXPIRY_POINTS_LIST(POINT) \
+    POINT(0U) POINT(20U) POINT(40U) POINT(60U) POINT(80U) POINT(100U)
+
+#define OS_TASK_COUNT_ONE(ARG,TASK,PERIOD,OFFSET,PRIORITY,POLICY)    + 1U
+
+/* Number of the configured tasks */
+#define OS_TASKS_COUNT                  (0U OS_TASKS_LIST(OS_TASK_COUNT_ONE, 0))
+
+/* Number of ticks in one hyperperiod, one expiry point per tick */
+#define OS_EXPIRY_POINTS                (OS_HYPERPERIOD / OS_BASE_TIME)
+
+#endif /* OS_CFG_H_ */
@@ -7,6 +7,7 @@
 
 
 #include "Port.h"
+#include "MCU.h"
 #include "tm4c123gh6pm_registers.h"
 
 #if(PORT_DEV_ERROR_DETECT == STD_ON)
@@ -22,10 +23,76 @@
 
 #endif
 
+/* Runtime descriptor of a configured pin, resolved once by Port_Init */
+typedef struct
+{
+    /* Base address of the port that this pin belongs to */
+    uint32 Base_Address;
+    /* Bit-band alias word of the pin bit in GPIODIR, one store changes the pin direction atomically */
+    uint32 Dir_Bit_Address;
+    /* Precomputed mask of the pin bit inside its port */
+    uint8 Bit_Mask;
+    /* Position of the pin inside its port */
+    uint8 Pin_Num;
+    /* Alternate functions of the pin in Port_PinFunctions: First_Function --> First_Function + Functions_Count - 1 */
+    uint8 First_Function;
+    uint8 Functions_Count;
+    /* Direction and mode changeability of the pin (PORT_PIN_DIRECTION_CHANGEABLE_FLAG, PORT_PIN_MODE_CHANGEABLE_FLAG) */
+    uint8 Flags;
+}Port_PinDescriptorType;
+
+#define PORT_PIN_DIRECTION_CHANGEABLE_FLAG  (0x01U)
+#define PORT_PIN_MODE_CHANGEABLE_FLAG       (0x02U)
+
+/* Changeability flags of the packed pin configuration CFG */
+#define PORT_PIN_FLAGS(CFG)\
+    (uint8)(((PORT_PIN_CFG_DIRECTION_CHANGEABLE(CFG) == PORT_PIN_DIRECTION_CHANGEABLE) ? PORT_PIN_DIRECTION_CHANGEABLE_FLAG : 0U)\
+          | ((PORT_PIN_CFG_MODE_CHANGEABLE(CFG) == PORT_PIN_MODE_CHANGEABLE) ? PORT_PIN_MODE_CHANGEABLE_FLAG : 0U))
+
+/* Address of the GPIODATA aperture that decodes only the pins of MASK (address bits [9:2]) */
+#define PORT_DATA_APERTURE_ADDRESS(BASE,MASK) ((BASE) + ((uint32)(MASK) << 2U))
+
 /*Static Global Variables Definition*/
 STATIC const Port_ConfigPin *Port_configPtr = NULL_PTR;
+STATIC const Port_PortImageType * const *Port_portImages = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
+/* Pins resolved at initialization and shared by Port_SetPinDirection and Port_SetPinMode */
+STATIC Port_PinDescriptorType Port_PinDescriptors[PORT_CONFIGURED_PINS];
+
+/* Base address of every port indexed by the Port ID on the GPIO aperture selected in Mcu_Cfg.h */
+STATIC const uint32 Port_BaseAddress[PORT_CONFIGURED_PORTS] =
+{
+    MCU_GPIO_PORTA_BASE_ADDRESS,
+    MCU_GPIO_PORTB_BASE_ADDRESS,
+    MCU_GPIO_PORTC_BASE_ADDRESS,
+    MCU_GPIO_PORTD_BASE_ADDRESS,
+    MCU_GPIO_PORTE_BASE_ADDRESS,
+    MCU_GPIO_PORTF_BASE_ADDRESS
+};
+
+/* Offset of every register of Port_RegisterIndexType */
+STATIC const uint16 Port_ImageRegisterOffset[PORT_IMAGE_REGISTERS] =
+{
+    PORT_CR_REG_OFFSET,
+    PORT_AMSEL_REG_OFFSET,
+    PORT_PCTL_REG_OFFSET,
+    PORT_AFSEL_REG_OFFSET,
+    PORT_DR2R_REG_OFFSET,
+    PORT_DR4R_REG_OFFSET,
+    PORT_DR8R_REG_OFFSET,
+    PORT_SLR_REG_OFFSET,
+    PORT_ODR_REG_OFFSET,
+    PORT_DEN_REG_OFFSET,
+    PORT_DATA_REG_OFFSET,
+    PORT_DIR_REG_OFFSET,
+    PORT_PUR_REG_OFFSET,
+    PORT_PDR_REG_OFFSET
+};
+
+/* Value to be written in GPIOLOCK to unlock the GPIOCR register */
+#define PORT_GPIO_LOCK_KEY                (0x4C4F434BUL)
+
 /*
  * Service name: Port_Init
  * Service ID[hex]: 0x00
@@ -40,14 +107,22 @@ STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 void Port_Init(const Port_ConfigType* ConfigPtr)
 {
     /*Steps for Initialization:
-     * Get the Base Address of the Port of every pin
-     * Check if this pin needs unlocking the commit or if it is from the JTAG pins
-     * Check the mode of the Pin DIO, ADC, Rest of Modes
-     * Set the Direction of the Pin and the Resistor Type
-     * Set the Initial Value for the Pin
+     * The register images of every port are generated at compile time in Port_PBcfg.c
+     * from the pins configuration (the JTAG pins are skipped, the locked pins are committed)
+     * and the reset values of the registers, so that only the registers that differ from
+     * their reset value are written here, in the order of Port_RegisterIndexType:
+     * CR (after unlocking), AMSEL, PCTL, AFSEL, DR2R, DR4R, DR8R, SLR, ODR (drive of the outputs before they are enabled),
+     * DEN, DATA (before the pins become outputs), DIR, PUR, PDR.
+     * Port_Init is expected to be called once after reset.
      * */
-    volatile Port_PinType pinIndex = PORT_PIN0_ID;
-    volatile uint32 *Port_Base_Address_Ptr = NULL_PTR;
+    const Port_PortImageType *image = NULL_PTR;
+    Port_PinDescriptorType *descriptor = NULL_PTR;
+    Port_PinType pinIndex = PORT_PIN0_ID;
+    uint8 portIndex = 0U;
+    uint8 registerIndex = 0U;
+    uint8 functionIndex = 0U;
+    uint8 pinKey = 0U;
+    uint32 baseAddress = 0U;
 
     /*Check for Configuration pointing to Null*/
 #if(PORT_DEV_ERROR_DETECT == STD_ON)
@@ -63,167 +138,63 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
     {
         Port_Status = PORT_INITIALIZED;
         Port_configPtr = ConfigPtr->Pin;
-    }
-
-    for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
-    {
-        /*Saving the Base Address of the port of the specified pin*/
-        switch(Port_configPtr[pinIndex].port_num)
-        {
-        case PORT_PORTA_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case PORT_PORTB_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case PORT_PORTC_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case PORT_PORTD_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case PORT_PORTE_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case PORT_PORTF_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        default:
-            break;
-        }
-
-        /*Checking for the locked pins to unlock the commit*/
-        if((Port_configPtr[pinIndex].port_num == PORT_PORTD_ID) && (Port_configPtr[pinIndex].pin_num == PORT_PIN7_ID)\
-          || (Port_configPtr[pinIndex].port_num == PORT_PORTF_ID) && (Port_configPtr[pinIndex].pin_num == PORT_PIN0_ID))
-        {
-            /*Unlock the GPIOCR Register*/
-            *(volatile uint32*)((volatile uint8*)Port_Base_Address_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-
-            /*Set the corresponding bit in GPIOCR register to allow changes to this pin*/
-            SET_BIT(*(volatile uint32*)((volatile uint8*)Port_Base_Address_Ptr + PORT_LOCK_REG_OFFSET), Port_configPtr[pinIndex].pin_num);
-        }
-        else if((Port_configPtr[pinIndex].port_num == PORT_PORTC_ID) && (Port_configPtr[pinIndex].pin_num <= PORT_PIN3_ID))
-        {
-            /*Do Nothing since these are the JTAG pins*/
-            continue;
-        }
-        else
-        {
-            /*Do Nothing Other pins does not need unlocking the Commit Register*/
-        }
-
-        /*Check Pin Modes*/
-        if(Port_configPtr[pinIndex].pin_mode == PORT_PIN_MODE_DIO)
-        {
-            /*
-             * 1. Disable Analog Functionality
-             * 2. Clear the 4 PMCx bits in GPIOPCTL
-             * 3. Disable Alternative Functionality
-             * 4. Enable Digital Functionality
-            */
-
-            /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AMSEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-            /* Clear the PMCx bits for this pin */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
-
-            /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AFSEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-            /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DEN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-        }
-        else if(Port_configPtr[pinIndex].pin_mode == PORT_PIN_MODE_ADC)
-        {
-            /*
-             * 1. Enable Analog Functionality
-             * 2. Clear the 4 PMCx bits in GPIOPCTL
-             * 3. Disable Alternative Functionality
-             * 4. Disable Digital Functionality
-            */
-
-            /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AMSEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-            /* Clear the PMCx bits for this pin */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
-
-            /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AFSEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-            /* clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DEN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-        }
-        else
-        {
-            /*
-             * Any Other Mode Steps:
-             * 1. Disable Analog Functionality
-             * 2. Enable Alternative Functionality
-             * 3. Write the Alternative Function ID in PMCx bits for this pin
-             * 4. Disable Digital Functionality
-            */
-
-            /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AMSEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-            /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AFSEL_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-            /* Write the Alternative Function ID in PMCx bits for this pin */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PCTL_REG_OFFSET) |= ~(0x0000000F << (Port_configPtr[pinIndex].pin_num * 4));
-
-            /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DEN_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-        }
+        Port_portImages = ConfigPtr->Port_Image;
 
-        /*Setting the Direction of the pin*/
-        if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_OUT)
+        for(portIndex = 0U; portIndex < PORT_CONFIGURED_PORTS; portIndex++)
         {
-            /*Set the Corresponding bit in GPIODIR to configure it as output pin*/
-            SET_BIT(*(volatile uint32*)((volatile uint8*)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET), Port_configPtr[pinIndex].pin_num);
+            image       = Port_portImages[portIndex];
+            baseAddress = Port_BaseAddress[portIndex];
 
-            /*Initializes the pin with the initial value*/
-            if(Port_configPtr[pinIndex].pin_initial_value == PORT_PIN_LEVEL_LOW)
+            if(image->Write_Mask & (1U << PORT_REG_CR))
             {
-                /*Clear the corresponding bit in GPIO Data Register*/
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DATA_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+                /* Unlock the GPIOCR Register before committing the locked pins */
+                HW_REG_WRITE(baseAddress + PORT_LOCK_REG_OFFSET, PORT_GPIO_LOCK_KEY);
             }
-            else if(Port_configPtr[pinIndex].pin_initial_value == PORT_PIN_LEVEL_HIGH)
+            else
             {
-               /*Set the Corresponding bit in GPIO Data Register*/
-               SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DATA_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+                /*Do Nothing this port has no locked pins*/
             }
-        }
-        else if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_IN)
-        {
-            /*Clear the Corresponding bit in GPIODIR to configure it as input pin*/
-            CLEAR_BIT(*(volatile uint32*)((volatile uint8*)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET), Port_configPtr[pinIndex].pin_num);
 
-            /*Check for the resistor*/
-            if(Port_configPtr[pinIndex].pin_resistor == PULL_UP)
+            for(registerIndex = 0U; registerIndex < PORT_IMAGE_REGISTERS; registerIndex++)
             {
-                /* Set the corresponding bit in the GPIOPUR register to enable the internal pull up pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PUR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+                if(image->Write_Mask & (1U << registerIndex))
+                {
+                    HW_REG_WRITE(baseAddress + Port_ImageRegisterOffset[registerIndex], image->Value[registerIndex]);
+                }
+                else
+                {
+                    /*Do Nothing the register keeps its reset value*/
+                }
             }
-            else if(Port_configPtr[pinIndex].pin_resistor == PULL_DOWN)
+        }
+
+        /*
+         * Resolve the port base address, the GPIODIR bit-band word, the changeability and the alternate functions of every pin once.
+         * The pins and Port_PinFunctions are both sorted by port and pin (checked at compile time in Port_PBcfg.c)
+         * so one pass over the functions table is enough.
+         */
+        for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
+        {
+            descriptor = &Port_PinDescriptors[pinIndex];
+            pinKey     = PORT_PIN_FUNCTION_KEY(PORT_PIN_CFG_PORT(Port_configPtr[pinIndex]), PORT_PIN_CFG_PIN(Port_configPtr[pinIndex]));
+
+            while((functionIndex < PORT_PIN_FUNCTIONS) && (Port_PinFunctions[functionIndex].Port_Pin < pinKey))
             {
-                /* Set the corresponding bit in the GPIOPDR register to enable the internal pull down pin */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PDR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+                functionIndex++;
             }
-            else
+            descriptor->First_Function  = functionIndex;
+            while((functionIndex < PORT_PIN_FUNCTIONS) && (Port_PinFunctions[functionIndex].Port_Pin == pinKey))
             {
-                /* Clear the corresponding bit in the GPIOPUR register to disable the internal pull up pin */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PUR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-
-                /* Clear the corresponding bit in the GPIOPDR register to disable the internal pull down pin */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PDR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
+                functionIndex++;
             }
-        }
-        else
-        {
-            /*Do Nothing*/
+            descriptor->Functions_Count = (uint8)(functionIndex - descriptor->First_Function);
+
+            descriptor->Base_Address    = Port_BaseAddress[PORT_PIN_CFG_PORT(Port_configPtr[pinIndex])];
+            descriptor->Dir_Bit_Address = PERIPHERAL_BIT_BAND_ALIAS(descriptor->Base_Address + PORT_DIR_REG_OFFSET,
+                                                                    PORT_PIN_CFG_PIN(Port_configPtr[pinIndex]));
+            descriptor->Bit_Mask        = (uint8)(1U << PORT_PIN_CFG_PIN(Port_configPtr[pinIndex]));
+            descriptor->Pin_Num         = PORT_PIN_CFG_PIN(Port_configPtr[pinIndex]);
+            descriptor->Flags           = PORT_PIN_FLAGS(Port_configPtr[pinIndex]);
         }
     }
 }
@@ -244,45 +215,35 @@ void Port_Init(const Port_ConfigType* ConfigPtr)
 
 void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
 {
-    volatile uint32 *Port_Base_Address_Ptr = NULL_PTR;
     uint8 error = FALSE;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* checks if the pin ID valid or not */
-    if ( Pin >= PORT_CONFIGURED_PINS)
+    /* checks if the port initialized or not */
+    if (Port_Status == PORT_NOT_INITIALIZED)
     {
         Det_ReportError(PORT_MODULE_ID,
                 PORT_INSTANCE_ID,
                 PORT_SET_PIN_DIRECTION_SID,
-                PORT_E_PARAM_PIN);
+                PORT_E_UNINIT);
+
         error = TRUE;
     }
-    else
-    {
-        /* Do Nothing */
-    }
-
-    /* checks if the pin direction is changeable or not */
-    if (Port_configPtr[Pin].pin_direction_changeable == PORT_PIN_DIRECTION_NOT_CHANGEABLE)
+    /* check if the pin ID valid or not */
+    else if (Pin >= PORT_CONFIGURED_PINS)
     {
         Det_ReportError(PORT_MODULE_ID,
                 PORT_INSTANCE_ID,
                 PORT_SET_PIN_DIRECTION_SID,
-                PORT_E_DIRECTION_UNCHANGEABLE);
-
+                PORT_E_PARAM_PIN);
         error = TRUE;
     }
-    else
+    /* checks if the pin direction is changeable or not */
+    else if (!(Port_PinDescriptors[Pin].Flags & PORT_PIN_DIRECTION_CHANGEABLE_FLAG))
     {
-        /* Do Nothing */
-    }
-
-    /* checks if the port initialized or not */
-    if (Port_Status == PORT_NOT_INITIALIZED) {
         Det_ReportError(PORT_MODULE_ID,
                 PORT_INSTANCE_ID,
                 PORT_SET_PIN_DIRECTION_SID,
-                PORT_E_UNINIT);
+                PORT_E_DIRECTION_UNCHANGEABLE);
 
         error = TRUE;
     }
@@ -294,41 +255,15 @@ void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
 
     if(FALSE == error)
     {
-        /*Saving the Base Address of the port of the specified pin*/
-        switch(Port_configPtr[Pin].port_num)
-        {
-        case PORT_PORTA_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case PORT_PORTB_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case PORT_PORTC_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case PORT_PORTD_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case PORT_PORTE_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case PORT_PORTF_ID:
-            Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        default:
-            break;
-        }
-
         if(Direction == PORT_PIN_OUT)
         {
-            /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[Pin].pin_num);
-
+            /* Set the pin bit in the GPIODIR register through its bit-band word to configure it as output pin */
+            HW_REG_WRITE(Port_PinDescriptors[Pin].Dir_Bit_Address, STD_HIGH);
         }
         else if(PORT_PIN_IN == Direction)
         {
-            /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            /* Clear the pin bit in the GPIODIR register through its bit-band word to configure it as input pin */
+            HW_REG_WRITE(Port_PinDescriptors[Pin].Dir_Bit_Address, STD_LOW);
         }
         else
         {
@@ -357,8 +292,9 @@ void Port_SetPinDirection(Port_PinType Pin,Port_PinDirectionType Direction)
 void Port_RefreshPortDirection(void)
 {
     uint8 error = FALSE;
-    volatile uint32 * Port_Base_Address_Ptr = NULL_PTR;
-    volatile Port_PinType pinIndex = PORT_PIN0_ID;
+    const Port_PortImageType *image = NULL_PTR;
+    uint8 portIndex = 0U;
+    uint32 dirAddress = 0U;
 
 
     #if (PORT_DEV_ERROR_DETECT == STD_ON)
@@ -380,54 +316,24 @@ void Port_RefreshPortDirection(void)
 
         if(FALSE == error)
         {
-            /*Saving the Base Address of the port of the specified pin*/
-            switch(Port_configPtr[pinIndex].port_num)
-            {
-            case PORT_PORTA_ID:
-                Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTA_BASE_ADDRESS;
-                break;
-            case PORT_PORTB_ID:
-                Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTB_BASE_ADDRESS;
-                break;
-            case PORT_PORTC_ID:
-                Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTC_BASE_ADDRESS;
-                break;
-            case PORT_PORTD_ID:
-                Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTD_BASE_ADDRESS;
-                break;
-            case PORT_PORTE_ID:
-                Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTE_BASE_ADDRESS;
-                break;
-            case PORT_PORTF_ID:
-                Port_Base_Address_Ptr = (volatile uint32*)GPIO_PORTF_BASE_ADDRESS;
-                break;
-            default:
-                break;
-            }
-
-            for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
+            /*
+             * Restore the configured direction of the pins that are not changeable during runtime,
+             * the pins configured as direction changeable keep the direction set by Port_SetPinDirection.
+             * One masked GPIODIR update per port using the precomputed DIR image and refresh mask.
+             */
+            for(portIndex = 0U; portIndex < PORT_CONFIGURED_PORTS; portIndex++)
             {
-                if(Port_configPtr[pinIndex].pin_direction_changeable == PORT_PIN_DIRECTION_CHANGEABLE)
+                image = Port_portImages[portIndex];
+                if(image->Dir_Refresh_Mask != 0U)
                 {
-                    if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_OUT)
-                    {
-                        /* Set the corresponding bit in the GPIODIR register to configure it as output pin */
-                        SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-                    }
-                    else if(Port_configPtr[pinIndex].pin_direction == PORT_PIN_IN)
-                    {
-                        /* Clear the corresponding bit in the GPIODIR register to configure it as input pin */
-                        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DIR_REG_OFFSET) , Port_configPtr[pinIndex].pin_num);
-                    }
-                    else
-                    {
-                        /*Do Nothing*/
-                    }
+                    dirAddress = Port_BaseAddress[portIndex] + PORT_DIR_REG_OFFSET;
+                    HW_REG_WRITE(dirAddress, (HW_REG_READ(dirAddress) & ~(uint32)image->Dir_Refresh_Mask)
+                                             | (image->Value[PORT_REG_DIR] & image->Dir_Refresh_Mask));
+                }
+                else
+                {
+                    /*Do Nothing all the pins of this port are direction changeable*/
                 }
-               else
-               {
-                   /*Do Nothing*/
-               }
             }
         }
         else
@@ -494,44 +400,38 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo)
 void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
 {
     uint8 error = FALSE;
-    volatile uint32 * Port_Base_Address_Ptr = NULL_PTR;
+    uint32 Port_Base_Address = 0U;
+    uint32 pinMask = 0U;
+    uint32 pmcMask = 0U;
+    uint8 functionIndex = 0U;
+    uint8 functionEnd = 0U;
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-
-    /* check if the pin ID valid or not */
-    if ( Pin >= PORT_CONFIGURED_PINS)
+    /* check if the port initialized or not */
+    if (Port_Status == PORT_NOT_INITIALIZED)
     {
         Det_ReportError(PORT_MODULE_ID,
                 PORT_INSTANCE_ID,
                 PORT_SET_PIN_MODE_SID,
-                PORT_E_PARAM_PIN);
+                PORT_E_UNINIT);
         error = TRUE;
     }
-    else
-    {
-        /* Do Nothing */
-    }
-
-    /* check if the pin Mode is changeable or not */
-    if (Port_configPtr[Pin].pin_mode_changeable == PORT_PIN_MODE_NOT_CHANGEABLE)
+    /* check if the pin ID valid or not */
+    else if (Pin >= PORT_CONFIGURED_PINS)
     {
         Det_ReportError(PORT_MODULE_ID,
                 PORT_INSTANCE_ID,
                 PORT_SET_PIN_MODE_SID,
-                PORT_E_MODE_UNCHANGEABLE);
+                PORT_E_PARAM_PIN);
         error = TRUE;
     }
-    else
+    /* check if the pin Mode is changeable or not */
+    else if (!(Port_PinDescriptors[Pin].Flags & PORT_PIN_MODE_CHANGEABLE_FLAG))
     {
-        /* Do Nothing */
-    }
-
-    /* check if the port initialized or not */
-    if (Port_Status == PORT_NOT_INITIALIZED) {
         Det_ReportError(PORT_MODULE_ID,
                 PORT_INSTANCE_ID,
                 PORT_SET_PIN_MODE_SID,
-                PORT_E_UNINIT);
+                PORT_E_MODE_UNCHANGEABLE);
         error = TRUE;
     }
     else
@@ -542,6 +442,11 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
 
     if(FALSE == error)
     {
+        /* Base address and masks of the pin resolved by Port_Init */
+        Port_Base_Address = Port_PinDescriptors[Pin].Base_Address;
+        pinMask           = Port_PinDescriptors[Pin].Bit_Mask;
+        pmcMask           = 0x0000000FUL << (Port_PinDescriptors[Pin].Pin_Num * 4U);
+
         /*Check Pin Modes*/
         if(Mode == PORT_PIN_MODE_DIO)
         {
@@ -553,16 +458,16 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
             */
 
             /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AMSEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            HW_REG_CLEAR_BITS(Port_Base_Address + PORT_AMSEL_REG_OFFSET, pinMask);
 
             /* Clear the PMCx bits for this pin */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PCTL_REG_OFFSET) &= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));
+            HW_REG_CLEAR_BITS(Port_Base_Address + PORT_PCTL_REG_OFFSET, pmcMask);
 
             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AFSEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            HW_REG_CLEAR_BITS(Port_Base_Address + PORT_AFSEL_REG_OFFSET, pinMask);
 
             /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DEN_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            HW_REG_SET_BITS(Port_Base_Address + PORT_DEN_REG_OFFSET, pinMask);
         }
         else if(Mode == PORT_PIN_MODE_ADC)
         {
@@ -574,45 +479,204 @@ void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode)
             */
 
             /* Set the corresponding bit in the GPIOAMSEL register to enable analog functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AMSEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            HW_REG_SET_BITS(Port_Base_Address + PORT_AMSEL_REG_OFFSET, pinMask);
 
             /* Clear the PMCx bits for this pin */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PCTL_REG_OFFSET) != ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));
+            HW_REG_CLEAR_BITS(Port_Base_Address + PORT_PCTL_REG_OFFSET, pmcMask);
 
             /* Disable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AFSEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            HW_REG_CLEAR_BITS(Port_Base_Address + PORT_AFSEL_REG_OFFSET, pinMask);
 
             /* clear the corresponding bit in the GPIODEN register to disable digital functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DEN_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            HW_REG_CLEAR_BITS(Port_Base_Address + PORT_DEN_REG_OFFSET, pinMask);
         }
         else
         {
-            /*
-             * Any Other Mode Steps:
-             * 1. Disable Analog Functionality
-             * 2. Enable Alternative Functionality
-             * 3. Write the Alternative Function ID in PMCx bits for this pin
-             * 4. Disable Digital Functionality
-            */
+            /* Find the PMCx value of the requested mode in the alternate functions of this pin */
+            functionIndex = Port_PinDescriptors[Pin].First_Function;
+            functionEnd   = (uint8)(functionIndex + Port_PinDescriptors[Pin].Functions_Count);
+            while((functionIndex < functionEnd) && (Port_PinFunctions[functionIndex].Mode != Mode))
+            {
+                functionIndex++;
+            }
 
-            /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AMSEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+            if(functionIndex < functionEnd)
+            {
+                /*
+                 * Any Other Mode Steps:
+                 * 1. Disable Analog Functionality
+                 * 2. Write the Alternative Function ID in PMCx bits for this pin
+                 * 3. Enable Alternative Functionality
+                 * 4. Enable Digital Functionality
+                */
+
+                /* Clear the corresponding bit in the GPIOAMSEL register to disable analog functionality on this pin */
+                HW_REG_CLEAR_BITS(Port_Base_Address + PORT_AMSEL_REG_OFFSET, pinMask);
+
+                /* Write the Alternative Function ID in PMCx bits for this pin, the other pins keep their functions */
+                HW_REG_WRITE(Port_Base_Address + PORT_PCTL_REG_OFFSET,
+                             (HW_REG_READ(Port_Base_Address + PORT_PCTL_REG_OFFSET) & ~pmcMask)
+                             | ((uint32)Port_PinFunctions[functionIndex].Pmc << (Port_PinDescriptors[Pin].Pin_Num * 4U)));
+
+                /* Enable Alternative function for this pin by set the corresponding bit in GPIOAFSEL register */
+                HW_REG_SET_BITS(Port_Base_Address + PORT_AFSEL_REG_OFFSET, pinMask);
+
+                /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
+                HW_REG_SET_BITS(Port_Base_Address + PORT_DEN_REG_OFFSET, pinMask);
+            }
+            else
+            {
+                /* The pin has no alternate function in this mode */
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+                Det_ReportError(PORT_MODULE_ID,
+                        PORT_INSTANCE_ID,
+                        PORT_SET_PIN_MODE_SID,
+                        PORT_E_PARAM_INVALID_MODE);
+#endif
+            }
+        }
+    }
+    else
+    {
+        /*Do Nothing*/
+    }
 
-            /* Enable Alternative function for this pin by clear the corresponding bit in GPIOAFSEL register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_AFSEL_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+}
+#endif
 
-            /* Write the Alternative Function ID in PMCx bits for this pin */
-            *(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_PCTL_REG_OFFSET) |= ~(0x0000000F << (Port_configPtr[Pin].pin_num * 4));
 
-            /* Set the corresponding bit in the GPIODEN register to enable digital functionality on this pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Base_Address_Ptr + PORT_DEN_REG_OFFSET) , Port_configPtr[Pin].pin_num);
+/*
+ * Service name: Port_SwitchConfig
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):     From -> ID of the configuration set currently applied
+                        To   -> ID of the configuration set to be applied
+ * Parameters (inout):  None
+ * Parameters (out):    None
+ * Return value:        None
+ * Description: Switches the port pins from one post-build configuration set to another,
+ *              only the pins that differ between the two sets are written.
+*/
+#if (PORT_SWITCH_CONFIG_API == STD_ON)
+void Port_SwitchConfig(Port_ConfigSetType From, Port_ConfigSetType To)
+{
+    uint8 error = FALSE;
+    const Port_PortImageType *fromImage = NULL_PTR;
+    const Port_PortImageType *toImage = NULL_PTR;
+    Port_PinType pinIndex = PORT_PIN0_ID;
+    uint8 portIndex = 0U;
+    uint8 registerIndex = 0U;
+    uint16 changedRegisters = 0U;
+    uint32 baseAddress = 0U;
+    uint32 registerAddress = 0U;
+    uint32 changeMask = 0U;
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the port initialized or not */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                PORT_INSTANCE_ID,
+                PORT_SWITCH_CONFIG_SID,
+                PORT_E_UNINIT);
+        error = TRUE;
+    }
+    /* check if the sets ID are valid and From is the set currently applied */
+    else if ((From >= PORT_CONFIG_SETS) || (To >= PORT_CONFIG_SETS)
+          || (Port_configPtr != Port_ConfigSets[From]->Pin))
+    {
+        Det_ReportError(PORT_MODULE_ID,
+                PORT_INSTANCE_ID,
+                PORT_SWITCH_CONFIG_SID,
+                PORT_E_PARAM_CONFIG);
+        error = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+
+    /* The set IDs index Port_ConfigSets and Port_ConfigDeltas, out of range IDs never reach the hardware */
+    if((From >= PORT_CONFIG_SETS) || (To >= PORT_CONFIG_SETS))
+    {
+        error = TRUE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if(FALSE == error)
+    {
+        /*
+         * The registers that differ between the two sets are known at compile time (Port_ConfigDeltas),
+         * only their bits that differ are updated so the pins common to both sets are never glitched
+         * and keep any direction or mode changed during runtime.
+         * The registers are written in the order of Port_RegisterIndexType like Port_Init,
+         * GPIODATA is written through its aperture before the new outputs are enabled in GPIODIR.
+         */
+        for(portIndex = 0U; portIndex < PORT_CONFIGURED_PORTS; portIndex++)
+        {
+            changedRegisters = Port_ConfigDeltas[From][To].Changed_Registers[portIndex];
+            if(changedRegisters != 0U)
+            {
+                fromImage   = Port_ConfigSets[From]->Port_Image[portIndex];
+                toImage     = Port_ConfigSets[To]->Port_Image[portIndex];
+                baseAddress = Port_BaseAddress[portIndex];
+
+                if(changedRegisters & (1U << PORT_REG_CR))
+                {
+                    /* Unlock the GPIOCR Register before committing the locked pins */
+                    HW_REG_WRITE(baseAddress + PORT_LOCK_REG_OFFSET, PORT_GPIO_LOCK_KEY);
+                }
+                else
+                {
+                    /*Do Nothing the locked pins are the same in both sets*/
+                }
+
+                for(registerIndex = 0U; registerIndex < PORT_IMAGE_REGISTERS; registerIndex++)
+                {
+                    if(!(changedRegisters & (1U << registerIndex)))
+                    {
+                        /*Do Nothing the register is the same in both sets*/
+                    }
+                    else if(PORT_REG_DATA == registerIndex)
+                    {
+                        /* Pins whose level changes and pins that become outputs, one store through the aperture */
+                        changeMask = (fromImage->Value[PORT_REG_DATA] ^ toImage->Value[PORT_REG_DATA])
+                                   | (toImage->Value[PORT_REG_DIR] & ~fromImage->Value[PORT_REG_DIR]);
+                        HW_REG_WRITE(PORT_DATA_APERTURE_ADDRESS(baseAddress, changeMask & 0xFFU), toImage->Value[PORT_REG_DATA]);
+                    }
+                    else
+                    {
+                        changeMask      = fromImage->Value[registerIndex] ^ toImage->Value[registerIndex];
+                        registerAddress = baseAddress + Port_ImageRegisterOffset[registerIndex];
+                        HW_REG_WRITE(registerAddress, (HW_REG_READ(registerAddress) & ~changeMask)
+                                                      | (toImage->Value[registerIndex] & changeMask));
+                    }
+                }
+            }
+            else
+            {
+                /*Do Nothing this port is the same in both sets*/
+            }
+        }
+
+        Port_configPtr  = Port_ConfigSets[To]->Pin;
+        Port_portImages = Port_ConfigSets[To]->Port_Image;
+
+        /* The pins keep their addresses, only their changeability may differ between the sets */
+        for(pinIndex = PORT_PIN0_ID; pinIndex < PORT_CONFIGURED_PINS; pinIndex++)
+        {
+            Port_PinDescriptors[pinIndex].Flags = PORT_PIN_FLAGS(Port_configPtr[pinIndex]);
         }
     }
     else
     {
         /*Do Nothing*/
     }
-
 }
 #endif
 
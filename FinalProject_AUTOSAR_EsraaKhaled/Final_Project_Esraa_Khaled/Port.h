@@ -82,6 +82,9 @@
 /*Service ID for Port Set Pin Mode */
 #define PORT_SET_PIN_MODE_SID                     (uint8)0x04
 
+/*Service ID for Port Switch Config (Not exist in AUTOSAR 4.0.3 PORT SWS Document) */
+#define PORT_SWITCH_CONFIG_SID                    (uint8)0x05
+
 
                             /*DET Error Code*/
 
@@ -122,6 +125,26 @@ typedef uint8 Port_PinType;
 /*Different port pin modes*/
 typedef uint8 Port_PinModeType;
 
+/*ID of a post-build configuration set (PortConf_xxx_CONFIG_SET)*/
+typedef uint8 Port_ConfigSetType;
+
+/*
+ * Electrical characteristics of an output pin: one drive strength (GPIODR2R/GPIODR4R/GPIODR8R)
+ * optionally combined with PORT_PIN_SLEW_RATE_CONTROL (GPIOSLR, 8-mA drive only) and PORT_PIN_OPEN_DRAIN (GPIOODR)
+ * Ex: (PORT_PIN_DRIVE_8MA | PORT_PIN_SLEW_RATE_CONTROL)
+ */
+typedef uint8 Port_PinDriveType;
+
+#define PORT_PIN_DRIVE_2MA                        (0x00U)
+#define PORT_PIN_DRIVE_4MA                        (0x01U)
+#define PORT_PIN_DRIVE_8MA                        (0x02U)
+#define PORT_PIN_DRIVE_STRENGTH_MASK              (0x03U)
+#define PORT_PIN_SLEW_RATE_CONTROL                (0x04U)
+#define PORT_PIN_OPEN_DRAIN                       (0x08U)
+
+/*PMCx value of the pins in DIO or ADC mode (no alternate function in GPIOPCTL)*/
+#define PORT_PIN_PMC_NONE                         (0U)
+
 /*Initial Value for a port Pin*/
 typedef enum
 {
@@ -156,25 +179,111 @@ typedef enum
     PORT_PIN_MODE_SPI
 }Port_PinInitialModeType;
 
-/*Type of the external data structure containing the initialization data for this module.*/
+/*
+ * Type of the external data structure containing the initialization data of one pin.
+ * The pin parameters are packed in 16 bits, use PORT_PIN_CONFIG_PACK to build an entry
+ * and the PORT_PIN_CFG_xxx accessors to read the fields back:
+ *   bits [2:0]   port_num                  bits [5:3]   pin_num
+ *   bit  6       pin_direction             bits [8:7]   pin_resistor
+ *   bits [12:9]  pin_mode                  bit  13      pin_direction_changeable
+ *   bit  14      pin_mode_changeable       bit  15      pin_initial_value
+ */
+typedef uint16 Port_ConfigPin;
+
+/*Position and width of every field of Port_ConfigPin*/
+#define PORT_PIN_CFG_PORT_SHIFT                   (0U)
+#define PORT_PIN_CFG_PORT_MASK                    (0x07U)
+#define PORT_PIN_CFG_PIN_SHIFT                    (3U)
+#define PORT_PIN_CFG_PIN_MASK                     (0x07U)
+#define PORT_PIN_CFG_DIRECTION_SHIFT              (6U)
+#define PORT_PIN_CFG_DIRECTION_MASK               (0x01U)
+#define PORT_PIN_CFG_RESISTOR_SHIFT               (7U)
+#define PORT_PIN_CFG_RESISTOR_MASK                (0x03U)
+#define PORT_PIN_CFG_MODE_SHIFT                   (9U)
+#define PORT_PIN_CFG_MODE_MASK                    (0x0FU)
+#define PORT_PIN_CFG_DIRECTION_CHANGEABLE_SHIFT   (13U)
+#define PORT_PIN_CFG_MODE_CHANGEABLE_SHIFT        (14U)
+#define PORT_PIN_CFG_INITIAL_VALUE_SHIFT          (15U)
+
+/*Build a packed pin entry at compile time*/
+#define PORT_PIN_CONFIG_PACK(PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT) \
+    ((Port_ConfigPin)((((uint16)(PORT)    & PORT_PIN_CFG_PORT_MASK)      << PORT_PIN_CFG_PORT_SHIFT)      \
+                    | (((uint16)(PIN)     & PORT_PIN_CFG_PIN_MASK)       << PORT_PIN_CFG_PIN_SHIFT)       \
+                    | (((uint16)(DIR)     & PORT_PIN_CFG_DIRECTION_MASK) << PORT_PIN_CFG_DIRECTION_SHIFT) \
+                    | (((uint16)(RES)     & PORT_PIN_CFG_RESISTOR_MASK)  << PORT_PIN_CFG_RESISTOR_SHIFT)  \
+                    | (((uint16)(MODE)    & PORT_PIN_CFG_MODE_MASK)      << PORT_PIN_CFG_MODE_SHIFT)      \
+                    | (((uint16)(DIR_CH)  & 0x01U) << PORT_PIN_CFG_DIRECTION_CHANGEABLE_SHIFT)            \
+                    | (((uint16)(MODE_CH) & 0x01U) << PORT_PIN_CFG_MODE_CHANGEABLE_SHIFT)                 \
+                    | (((uint16)(INIT)    & 0x01U) << PORT_PIN_CFG_INITIAL_VALUE_SHIFT)))
+
+/*Accessors of the packed pin entry*/
+#define PORT_PIN_CFG_PORT(CFG)                    ((uint8)(((CFG) >> PORT_PIN_CFG_PORT_SHIFT) & PORT_PIN_CFG_PORT_MASK))
+#define PORT_PIN_CFG_PIN(CFG)                     ((Port_PinType)(((CFG) >> PORT_PIN_CFG_PIN_SHIFT) & PORT_PIN_CFG_PIN_MASK))
+#define PORT_PIN_CFG_DIRECTION(CFG)               ((Port_PinDirectionType)(((CFG) >> PORT_PIN_CFG_DIRECTION_SHIFT) & PORT_PIN_CFG_DIRECTION_MASK))
+#define PORT_PIN_CFG_RESISTOR(CFG)                ((Port_InternalResistorType)(((CFG) >> PORT_PIN_CFG_RESISTOR_SHIFT) & PORT_PIN_CFG_RESISTOR_MASK))
+#define PORT_PIN_CFG_MODE(CFG)                    ((Port_PinModeType)(((CFG) >> PORT_PIN_CFG_MODE_SHIFT) & PORT_PIN_CFG_MODE_MASK))
+#define PORT_PIN_CFG_DIRECTION_CHANGEABLE(CFG)    ((uint8)(((CFG) >> PORT_PIN_CFG_DIRECTION_CHANGEABLE_SHIFT) & 0x01U))
+#define PORT_PIN_CFG_MODE_CHANGEABLE(CFG)         ((uint8)(((CFG) >> PORT_PIN_CFG_MODE_CHANGEABLE_SHIFT) & 0x01U))
+#define PORT_PIN_CFG_INITIAL_VALUE(CFG)           ((Port_PinLevelValueType)(((CFG) >> PORT_PIN_CFG_INITIAL_VALUE_SHIFT) & 0x01U))
+
+/*Registers of a port written by Port_Init in this order*/
+typedef enum
+{
+    PORT_REG_CR,
+    PORT_REG_AMSEL,
+    PORT_REG_PCTL,
+    PORT_REG_AFSEL,
+    PORT_REG_DR2R,
+    PORT_REG_DR4R,
+    PORT_REG_DR8R,
+    PORT_REG_SLR,
+    PORT_REG_ODR,
+    PORT_REG_DEN,
+    PORT_REG_DATA,
+    PORT_REG_DIR,
+    PORT_REG_PUR,
+    PORT_REG_PDR,
+    PORT_IMAGE_REGISTERS
+}Port_RegisterIndexType;
+
+/*Register values of a port generated at compile time from the pins configuration*/
 typedef struct
 {
-    uint8 port_num;
-    Port_PinType pin_num;
-    Port_PinDirectionType pin_direction;
-    Port_InternalResistorType pin_resistor;
-    Port_PinModeType pin_mode;
-    uint8 pin_direction_changeable;
-    uint8 pin_mode_changeable;
-    Port_PinLevelValueType pin_initial_value;
-}Port_ConfigPin;
-
-/*Array of Structures for all the configured pins*/
+    uint32 Value[PORT_IMAGE_REGISTERS];
+    /*Bit n is set when register n differs from its reset value and has to be written*/
+    uint16 Write_Mask;
+    /*Pins whose direction is not changeable during runtime, refreshed by Port_RefreshPortDirection*/
+    uint8 Dir_Refresh_Mask;
+}Port_PortImageType;
+
+/*Array of Structures for all the configured pins and the register images of all the ports*/
 typedef struct
 {
     Port_ConfigPin Pin[PORT_CONFIGURED_PINS];
+    /*The images are shared between the configuration sets that configure a port the same way*/
+    const Port_PortImageType *Port_Image[PORT_CONFIGURED_PORTS];
 }Port_ConfigType;
 
+/*
+ * Alternate function of a pin: the PMCx value to be written in GPIOPCTL to route the pin to a peripheral in the mode Mode.
+ * Port_Pin is PORT_PIN_FUNCTION_KEY(Port ID, Pin ID), the table is sorted by this key.
+ */
+typedef struct
+{
+    uint8 Port_Pin;
+    Port_PinModeType Mode;
+    uint8 Pmc;
+}Port_PinFunctionType;
+
+#define PORT_PIN_FUNCTION_KEY(PORT,PIN)           ((uint8)(((PORT) << 3U) | (PIN)))
+
+/*Registers to be written to move from one configuration set to another, generated at compile time*/
+typedef struct
+{
+    /*Bit n of the entry of a port is set when its register n differs between the two sets*/
+    uint16 Changed_Registers[PORT_CONFIGURED_PORTS];
+}Port_ConfigDeltaType;
+
 
                         /*Function Prototypes*/
 
@@ -257,10 +366,39 @@ void Port_GetVersionInfo(Std_VersionInfoType* versioninfo);
 void Port_SetPinMode(Port_PinType Pin,Port_PinModeType Mode);
 #endif
 
+
+/*
+ * Service name: Port_SwitchConfig
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in):     From -> ID of the configuration set currently applied
+                        To   -> ID of the configuration set to be applied
+ * Parameters (inout):  None
+ * Parameters (out):    None
+ * Return value:        None
+ * Description: Switches the port pins from one post-build configuration set to another,
+ *              only the pins that differ between the two sets are written.
+*/
+#if (PORT_SWITCH_CONFIG_API == STD_ON)
+void Port_SwitchConfig(Port_ConfigSetType From, Port_ConfigSetType To);
+#endif
+
                         /*External Global Variables*/
 
 /*External PB Structures to be used by Dio and other Modules*/
 extern const Port_ConfigType Port_Configuration;
+extern const Port_ConfigType Port_StandbyConfiguration;
+
+/*Alternate functions of the pins used by Port_SetPinMode*/
+extern const Port_PinFunctionType Port_PinFunctions[PORT_PIN_FUNCTIONS];
+
+/*Configuration sets indexed by their ID and the registers to be written between every two sets [From][To]*/
+extern const Port_ConfigType * const Port_ConfigSets[PORT_CONFIG_SETS];
+extern const Port_ConfigDeltaType Port_ConfigDeltas[PORT_CONFIG_SETS][PORT_CONFIG_SETS];
+
+/*Ports accessed by the configuration sets in SYSCTL GPIO registers bit order (bit 0 --> PORTA), clocked by the Mcu driver*/
+extern const uint8 Port_UsedPortsMask;
 
 
 #endif /* PORT_H_ */
@@ -32,10 +32,26 @@
 /*Pre-processor switch to enable / disable the use of the function*/
 #define PORT_SET_PIN_MODE_API                 (STD_ON)
 
+/*Pre-Compile Option for Adding/removing the service Port_SwitchConfig() from the code*/
+#define PORT_SWITCH_CONFIG_API                (STD_ON)
+
 
 /* Number of Configured PINS */
 #define PORT_CONFIGURED_PINS                  (43U)
 
+/* Number of the GPIO Ports (PORTA --> PORTF) */
+#define PORT_CONFIGURED_PORTS                 (6U)
+
+/* Number of the alternate functions in the Port_PinFunctions table */
+#define PORT_PIN_FUNCTIONS                    (81U)
+
+/* Number of the post-build configuration sets in Port_PBcfg.c */
+#define PORT_CONFIG_SETS                      (2U)
+
+/* Configuration sets ID */
+#define PortConf_NORMAL_CONFIG_SET            (0U)
+#define PortConf_STANDBY_CONFIG_SET           (1U)
+
 /* Ports ID */
 #define PORT_PORTA_ID                         (0U)
 #define PORT_PORTB_ID                         (1U)
@@ -33,54 +33,429 @@
   #error "The SW version of PBcfg.c does not match the expected version"
 #endif
 
-/* PB structure used with PORT_Init API */
-const Port_ConfigType Port_Configuration =  {
-                                             PORT_PORTA_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTA_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-
-                                             PORT_PORTB_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTB_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-
-                                             PORT_PORTC_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTC_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-
-                                             PORT_PORTD_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN6_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTD_ID, PORT_PIN7_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-
-                                             PORT_PORTE_ID, PORT_PIN0_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTE_ID, PORT_PIN1_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTE_ID, PORT_PIN2_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTE_ID, PORT_PIN3_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTE_ID, PORT_PIN4_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTE_ID, PORT_PIN5_ID, PORT_PIN_IN, OFF, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-
-                                             PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_OUT, OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                             PORT_PORTF_ID, PORT_PIN4_ID, PORT_PIN_IN,  PULL_UP, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW,
-                                            };
+/*
+ * Configuration of every pin:
+ * Port, Pin, Direction, Resistor, Mode, Direction Changeable, Mode Changeable, Initial Level, Drive, Function.
+ * Drive is the drive strength (PORT_PIN_DRIVE_2MA/4MA/8MA) optionally combined with PORT_PIN_SLEW_RATE_CONTROL
+ * (8-mA drive only) and PORT_PIN_OPEN_DRAIN.
+ * Function is the PMCx value of the pin in GPIOPCTL, PORT_PIN_PMC_NONE in DIO and ADC modes, otherwise it shall be
+ * listed for the pin and its mode in PORT_PIN_FUNCTIONS_LIST (checked at compile time).
+ * ENTRY is expanded once per pin, P and PRED are passed through for the register image builders below.
+ * The pins are listed per port so that the configuration sets only repeat the ports they change.
+ */
+#define PORT_PORTA_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN1_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN4_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN5_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN6_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTA_ID, PORT_PIN7_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+#define PORT_PORTB_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN1_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN6_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTB_ID, PORT_PIN7_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+#define PORT_PORTC_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN1_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN4_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN5_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN6_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTC_ID, PORT_PIN7_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+#define PORT_PORTD_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN1_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN4_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN5_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN6_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTD_ID, PORT_PIN7_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+#define PORT_PORTE_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTE_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTE_ID, PORT_PIN1_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTE_ID, PORT_PIN2_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTE_ID, PORT_PIN3_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTE_ID, PORT_PIN4_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTE_ID, PORT_PIN5_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+#define PORT_PORTF_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_OUT, OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_OUT, OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_OUT, OFF,     PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN4_ID, PORT_PIN_IN,  PULL_UP, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+/* PORTF in standby: the LED pins PF1-PF3 are released as inputs pulled down, SW1 (PF4) stays an input */
+#define PORT_PORTF_STANDBY_PINS(ENTRY,P,PRED) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_IN,  OFF,       PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_IN,  PULL_DOWN, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_NOT_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_IN,  PULL_DOWN, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_NOT_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_IN,  PULL_DOWN, PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_NOT_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE) \
+    ENTRY(P, PRED, PORT_PORTF_ID, PORT_PIN4_ID, PORT_PIN_IN,  PULL_UP,   PORT_PIN_MODE_DIO, PORT_PIN_DIRECTION_CHANGEABLE, PORT_PIN_MODE_CHANGEABLE, PORT_PIN_LEVEL_LOW, PORT_PIN_DRIVE_2MA, PORT_PIN_PMC_NONE)
+
+/*
+ * Ports of every configuration set, one PORT_<NAME>_PINS list per port in the order of the Port IDs.
+ * The register image of a port is generated once per list and shared by the sets using that list.
+ */
+#define PORT_NORMAL_PORTS(PORT,ENTRY,P,PRED) \
+    PORT(PORTA,ENTRY,P,PRED) PORT(PORTB,ENTRY,P,PRED) PORT(PORTC,ENTRY,P,PRED) \
+    PORT(PORTD,ENTRY,P,PRED) PORT(PORTE,ENTRY,P,PRED) PORT(PORTF,ENTRY,P,PRED)
+
+#define PORT_STANDBY_PORTS(PORT,ENTRY,P,PRED) \
+    PORT(PORTA,ENTRY,P,PRED) PORT(PORTB,ENTRY,P,PRED) PORT(PORTC,ENTRY,P,PRED) \
+    PORT(PORTD,ENTRY,P,PRED) PORT(PORTE,ENTRY,P,PRED) PORT(PORTF_STANDBY,ENTRY,P,PRED)
+
+#define PORT_PORT_PINS(NAME,ENTRY,P,PRED)        PORT_##NAME##_PINS(ENTRY,P,PRED)
+
+/* Pins of every configuration set, in the same order as the pins IDs */
+#define PORT_NORMAL_PINS_LIST(ENTRY,P,PRED)      PORT_NORMAL_PORTS(PORT_PORT_PINS,ENTRY,P,PRED)
+#define PORT_STANDBY_PINS_LIST(ENTRY,P,PRED)     PORT_STANDBY_PORTS(PORT_PORT_PINS,ENTRY,P,PRED)
+
+/*
+ * Alternate functions of the pins (datasheet GPIO Pins and Alternate Functions table):
+ * Port, Pin, Mode, PMCx value in GPIOPCTL. Sorted by port and pin, one function per mode of a pin.
+ * A, B, C and D are passed through to ENTRY.
+ */
+#define PORT_PIN_FUNCTIONS_LIST(ENTRY,A,B,C,D) \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN0_ID, PORT_PIN_MODE_CAN, 8U)   /* CAN1Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN0_ID, PORT_PIN_MODE_LIN, 1U)   /* U0Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN1_ID, PORT_PIN_MODE_CAN, 8U)   /* CAN1Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN1_ID, PORT_PIN_MODE_LIN, 1U)   /* U0Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN2_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI0Clk */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN3_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI0Fss */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN4_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI0Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN5_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI0Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN6_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM2  */ \
+    ENTRY(A, B, C, D, PORT_PORTA_ID, PORT_PIN7_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM3  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN0_ID, PORT_PIN_MODE_ICU, 7U)   /* T2CCP0  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN0_ID, PORT_PIN_MODE_LIN, 1U)   /* U1Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN1_ID, PORT_PIN_MODE_ICU, 7U)   /* T2CCP1  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN1_ID, PORT_PIN_MODE_LIN, 1U)   /* U1Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN2_ID, PORT_PIN_MODE_ICU, 7U)   /* T3CCP0  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN3_ID, PORT_PIN_MODE_ICU, 7U)   /* T3CCP1  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_MODE_CAN, 8U)   /* CAN0Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_MODE_ICU, 7U)   /* T1CCP0  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM2  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN4_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI2Clk */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_MODE_CAN, 8U)   /* CAN0Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_MODE_ICU, 7U)   /* T1CCP1  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM3  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN5_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI2Fss */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN6_ID, PORT_PIN_MODE_ICU, 7U)   /* T0CCP0  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN6_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM0  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN6_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI2Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN7_ID, PORT_PIN_MODE_ICU, 7U)   /* T0CCP1  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN7_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM1  */ \
+    ENTRY(A, B, C, D, PORT_PORTB_ID, PORT_PIN7_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI2Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN4_ID, PORT_PIN_MODE_ICU, 7U)   /* WT0CCP0 */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN4_ID, PORT_PIN_MODE_LIN, 1U)   /* U4Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN4_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM6  */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN5_ID, PORT_PIN_MODE_ICU, 7U)   /* WT0CCP1 */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN5_ID, PORT_PIN_MODE_LIN, 1U)   /* U4Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN5_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM7  */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN6_ID, PORT_PIN_MODE_ICU, 7U)   /* WT1CCP0 */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN6_ID, PORT_PIN_MODE_LIN, 1U)   /* U3Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN7_ID, PORT_PIN_MODE_ICU, 7U)   /* WT1CCP1 */ \
+    ENTRY(A, B, C, D, PORT_PORTC_ID, PORT_PIN7_ID, PORT_PIN_MODE_LIN, 1U)   /* U3Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN0_ID, PORT_PIN_MODE_ICU, 7U)   /* WT2CCP0 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN0_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM0  */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN0_ID, PORT_PIN_MODE_SPI, 1U)   /* SSI3Clk */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN1_ID, PORT_PIN_MODE_ICU, 7U)   /* WT2CCP1 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN1_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM1  */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN1_ID, PORT_PIN_MODE_SPI, 1U)   /* SSI3Fss */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN2_ID, PORT_PIN_MODE_ICU, 7U)   /* WT3CCP0 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN2_ID, PORT_PIN_MODE_SPI, 1U)   /* SSI3Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN3_ID, PORT_PIN_MODE_ICU, 7U)   /* WT3CCP1 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN3_ID, PORT_PIN_MODE_SPI, 1U)   /* SSI3Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN4_ID, PORT_PIN_MODE_ICU, 7U)   /* WT4CCP0 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN4_ID, PORT_PIN_MODE_LIN, 1U)   /* U6Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN5_ID, PORT_PIN_MODE_ICU, 7U)   /* WT4CCP1 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN5_ID, PORT_PIN_MODE_LIN, 1U)   /* U6Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN6_ID, PORT_PIN_MODE_ICU, 7U)   /* WT5CCP0 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN6_ID, PORT_PIN_MODE_LIN, 1U)   /* U2Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN7_ID, PORT_PIN_MODE_ICU, 7U)   /* WT5CCP1 */ \
+    ENTRY(A, B, C, D, PORT_PORTD_ID, PORT_PIN7_ID, PORT_PIN_MODE_LIN, 1U)   /* U2Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN0_ID, PORT_PIN_MODE_LIN, 1U)   /* U7Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN1_ID, PORT_PIN_MODE_LIN, 1U)   /* U7Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN4_ID, PORT_PIN_MODE_CAN, 8U)   /* CAN0Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN4_ID, PORT_PIN_MODE_LIN, 1U)   /* U5Rx    */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN4_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM4  */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN5_ID, PORT_PIN_MODE_CAN, 8U)   /* CAN0Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN5_ID, PORT_PIN_MODE_LIN, 1U)   /* U5Tx    */ \
+    ENTRY(A, B, C, D, PORT_PORTE_ID, PORT_PIN5_ID, PORT_PIN_MODE_PWM, 4U)   /* M0PWM5  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_MODE_CAN, 3U)   /* CAN0Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_MODE_ICU, 7U)   /* T0CCP0  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM4  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN0_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI1Rx  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_MODE_ICU, 7U)   /* T0CCP1  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM5  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN1_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI1Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_MODE_ICU, 7U)   /* T1CCP0  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM6  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN2_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI1Clk */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_MODE_CAN, 3U)   /* CAN0Tx  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_MODE_ICU, 7U)   /* T1CCP1  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_MODE_PWM, 5U)   /* M1PWM7  */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN3_ID, PORT_PIN_MODE_SPI, 2U)   /* SSI1Fss */ \
+    ENTRY(A, B, C, D, PORT_PORTF_ID, PORT_PIN4_ID, PORT_PIN_MODE_ICU, 7U)   /* T2CCP0  */
+
+/* Table entry of Port_PinFunctions */
+#define PORT_PIN_FUNCTION(A,B,C,D,PORT,PIN,MODE,PMC) {PORT_PIN_FUNCTION_KEY(PORT, PIN), MODE, PMC},
+
+/*
+ * Compile time check of the Function of every pin of a pins list:
+ * the pins in DIO or ADC mode have no PMCx value, the other pins use a function listed for their pin and mode.
+ */
+#define PORT_FUNCTION_MATCH(PORT,PIN,MODE,PMC,F_PORT,F_PIN,F_MODE,F_PMC)\
+    || (((PORT) == (F_PORT)) && ((PIN) == (F_PIN)) && ((MODE) == (F_MODE)) && ((PMC) == (F_PMC)))
+
+#define PORT_PIN_FUNCTION_VALID(P,PRED,PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE,PMC)\
+    && (PORT_PRED_GPIO_ADC(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE) ? ((PMC) == PORT_PIN_PMC_NONE)\
+        : (0 PORT_PIN_FUNCTIONS_LIST(PORT_FUNCTION_MATCH, PORT, PIN, MODE, PMC)))
+
+#define PORT_CHECK_FUNCTIONS(LIST)               (1 LIST(PORT_PIN_FUNCTION_VALID, 0, 0))
+
+/*
+ * Compile time check of the order that Port_Init relies on to resolve the functions of the pins in one pass:
+ * every entry closes the comparison with the previous entry and opens the one with the next entry,
+ * so a list expands to (0 <= K1) && (K1 <= K2) && ... && (Kn <= 0xFF) with K = PORT_PIN_FUNCTION_KEY(PORT, PIN).
+ * The pins of a configuration set are strictly increasing, Port_PinFunctions may list several functions per pin.
+ */
+#define PORT_PIN_KEY_ORDER(P,PRED,PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE,PMC)\
+    (int)PORT_PIN_FUNCTION_KEY(PORT, PIN)) && ((int)PORT_PIN_FUNCTION_KEY(PORT, PIN) <
+
+#define PORT_FUNCTION_KEY_ORDER(A,B,C,D,PORT,PIN,MODE,PMC)\
+    (int)PORT_PIN_FUNCTION_KEY(PORT, PIN)) && ((int)PORT_PIN_FUNCTION_KEY(PORT, PIN) <=
+
+#define PORT_CHECK_PINS_ORDER(LIST)              ((-1 < LIST(PORT_PIN_KEY_ORDER, 0, 0) 0x100))
+#define PORT_CHECK_FUNCTIONS_ORDER()             ((-1 < PORT_PIN_FUNCTIONS_LIST(PORT_FUNCTION_KEY_ORDER, 0, 0, 0, 0) 0x100))
+
+/* Pin table entry */
+#define PORT_PIN_CONFIG(P,PRED,PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE,PMC) PORT_PIN_CONFIG_PACK(PORT, PIN, DIR, RES, MODE, DIR_CH, MODE_CH, INIT),
+
+/*
+ * Register images builder:
+ * Every register of a port is computed at compile time from its reset value and the pins of a list above,
+ * Port_Init only writes the registers whose image differs from the reset value.
+ */
+
+/* Pin selection predicates */
+#define PORT_PRED_ALL(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)         (TRUE)
+#define PORT_PRED_ADC(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)         ((MODE) == PORT_PIN_MODE_ADC)
+#define PORT_PRED_DIGITAL(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)     ((MODE) != PORT_PIN_MODE_ADC)
+#define PORT_PRED_GPIO_ADC(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)    (((MODE) == PORT_PIN_MODE_DIO) || ((MODE) == PORT_PIN_MODE_ADC))
+#define PORT_PRED_ALTERNATE(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   (!PORT_PRED_GPIO_ADC(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE))
+#define PORT_PRED_OUT(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)         ((DIR) == PORT_PIN_OUT)
+#define PORT_PRED_OUT_HIGH(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)    (((DIR) == PORT_PIN_OUT) && ((INIT) == PORT_PIN_LEVEL_HIGH))
+#define PORT_PRED_IN(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)          ((DIR) == PORT_PIN_IN)
+#define PORT_PRED_PULL_UP(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)     (((DIR) == PORT_PIN_IN) && ((RES) == PULL_UP))
+#define PORT_PRED_PULL_DOWN(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   (((DIR) == PORT_PIN_IN) && ((RES) == PULL_DOWN))
+#define PORT_PRED_DIR_FIXED(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   ((DIR_CH) == PORT_PIN_DIRECTION_NOT_CHANGEABLE)
+#define PORT_PRED_DRIVE_2MA(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   (((DRIVE) & PORT_PIN_DRIVE_STRENGTH_MASK) == PORT_PIN_DRIVE_2MA)
+#define PORT_PRED_DRIVE_4MA(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   (((DRIVE) & PORT_PIN_DRIVE_STRENGTH_MASK) == PORT_PIN_DRIVE_4MA)
+#define PORT_PRED_DRIVE_8MA(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   (((DRIVE) & PORT_PIN_DRIVE_STRENGTH_MASK) == PORT_PIN_DRIVE_8MA)
+#define PORT_PRED_SLEW_RATE(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)   (PORT_PRED_DRIVE_8MA(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)\
+                                                                       && ((DRIVE) & PORT_PIN_SLEW_RATE_CONTROL))
+#define PORT_PRED_OPEN_DRAIN(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)  (((DRIVE) & PORT_PIN_OPEN_DRAIN) != 0U)
+
+/* JTAG pins PC0-PC3 are never configured by the driver */
+#define PORT_PIN_IS_JTAG(PORT,PIN)               (((PORT) == PORT_PORTC_ID) && ((PIN) <= PORT_PIN3_ID))
+
+#define PORT_PIN_BIT(P,PRED,PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE,PMC)\
+    | ((((PORT) == (P)) && !PORT_PIN_IS_JTAG(PORT,PIN) && PRED(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)) ? (1UL << (PIN)) : 0UL)
+
+/* Mask of the pins of port P in the pins list LIST selected by the predicate PRED */
+#define PORT_PINS(LIST,P,PRED)                   (0UL LIST(PORT_PIN_BIT, P, PRED))
+
+#define PORT_PIN_PMC_FIELD(P,PRED,PORT,PIN,DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE,PMC)\
+    | ((((PORT) == (P)) && !PORT_PIN_IS_JTAG(PORT,PIN) && PRED(DIR,RES,MODE,DIR_CH,MODE_CH,INIT,DRIVE)) ? ((uint32)(PMC) << ((PIN) * 4U)) : 0UL)
+
+/* PMCx fields of the pins of port P in the pins list LIST selected by the predicate PRED */
+#define PORT_PMC_VALUES(LIST,P,PRED)             (0UL LIST(PORT_PIN_PMC_FIELD, P, PRED))
+
+/* Expand a mask of pins to the mask of their 4-bit PMCx fields in GPIOPCTL */
+#define PORT_PMC_FIELDS(PINS)                    ((((PINS) & 0x01UL) ? 0x0000000FUL : 0UL) | (((PINS) & 0x02UL) ? 0x000000F0UL : 0UL)\
+                                                | (((PINS) & 0x04UL) ? 0x00000F00UL : 0UL) | (((PINS) & 0x08UL) ? 0x0000F000UL : 0UL)\
+                                                | (((PINS) & 0x10UL) ? 0x000F0000UL : 0UL) | (((PINS) & 0x20UL) ? 0x00F00000UL : 0UL)\
+                                                | (((PINS) & 0x40UL) ? 0x0F000000UL : 0UL) | (((PINS) & 0x80UL) ? 0xF0000000UL : 0UL))
+
+/* Reset values of the port registers, 2-mA drive on all the pins, only PORTC (JTAG) and the locked pins PD7/PF0 differ otherwise */
+#define PORT_RESET_CR(P)                         ((P) == PORT_PORTC_ID ? 0xF0UL : (P) == PORT_PORTD_ID ? 0x7FUL :\
+                                                  (P) == PORT_PORTF_ID ? 0xFEUL : 0xFFUL)
+#define PORT_RESET_JTAG(P,VALUE)                 ((P) == PORT_PORTC_ID ? (VALUE) : 0UL)
+#define PORT_RESET_AMSEL(P)                      (0UL)
+#define PORT_RESET_PCTL(P)                       PORT_RESET_JTAG(P, 0x00001111UL)
+#define PORT_RESET_AFSEL(P)                      PORT_RESET_JTAG(P, 0x0FUL)
+#define PORT_RESET_DR2R(P)                       (0xFFUL)
+#define PORT_RESET_DR4R(P)                       (0UL)
+#define PORT_RESET_DR8R(P)                       (0UL)
+#define PORT_RESET_SLR(P)                        (0UL)
+#define PORT_RESET_ODR(P)                        (0UL)
+#define PORT_RESET_DEN(P)                        PORT_RESET_JTAG(P, 0x0FUL)
+#define PORT_RESET_DATA(P)                       (0UL)
+#define PORT_RESET_DIR(P)                        (0UL)
+#define PORT_RESET_PUR(P)                        PORT_RESET_JTAG(P, 0x0FUL)
+#define PORT_RESET_PDR(P)                        (0UL)
+
+/* Pins that are locked after reset and need their GPIOCR bit to be set */
+#define PORT_LOCKED_PINS(P)                      ((P) == PORT_PORTD_ID ? 0x80UL : (P) == PORT_PORTF_ID ? 0x01UL : 0UL)
+
+/* Configured bits (MASK) set to VALUE, the other bits keep their reset value */
+#define PORT_IMAGE(RESET,MASK,VALUE)             (((RESET) & ~(MASK)) | (VALUE))
+
+/* Register images of port P in the pins list LIST */
+#define PORT_IMAGE_CR(LIST,P)                    (PORT_RESET_CR(P) | (PORT_PINS(LIST, P, PORT_PRED_ALL) & PORT_LOCKED_PINS(P)))
+#define PORT_IMAGE_AMSEL(LIST,P)                 PORT_IMAGE(PORT_RESET_AMSEL(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_ADC))
+#define PORT_IMAGE_PCTL(LIST,P)                  PORT_IMAGE(PORT_RESET_PCTL(P), PORT_PMC_FIELDS(PORT_PINS(LIST, P, PORT_PRED_ALL)),\
+                                                            PORT_PMC_VALUES(LIST, P, PORT_PRED_ALTERNATE))
+#define PORT_IMAGE_AFSEL(LIST,P)                 PORT_IMAGE(PORT_RESET_AFSEL(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_ALTERNATE))
+#define PORT_IMAGE_DR2R(LIST,P)                  PORT_IMAGE(PORT_RESET_DR2R(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_DRIVE_2MA))
+#define PORT_IMAGE_DR4R(LIST,P)                  PORT_IMAGE(PORT_RESET_DR4R(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_DRIVE_4MA))
+#define PORT_IMAGE_DR8R(LIST,P)                  PORT_IMAGE(PORT_RESET_DR8R(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_DRIVE_8MA))
+#define PORT_IMAGE_SLR(LIST,P)                   PORT_IMAGE(PORT_RESET_SLR(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_SLEW_RATE))
+#define PORT_IMAGE_ODR(LIST,P)                   PORT_IMAGE(PORT_RESET_ODR(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_OPEN_DRAIN))
+#define PORT_IMAGE_DEN(LIST,P)                   PORT_IMAGE(PORT_RESET_DEN(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_DIGITAL))
+#define PORT_IMAGE_DATA(LIST,P)                  PORT_IMAGE(PORT_RESET_DATA(P), PORT_PINS(LIST, P, PORT_PRED_OUT), PORT_PINS(LIST, P, PORT_PRED_OUT_HIGH))
+#define PORT_IMAGE_DIR(LIST,P)                   PORT_IMAGE(PORT_RESET_DIR(P), PORT_PINS(LIST, P, PORT_PRED_ALL), PORT_PINS(LIST, P, PORT_PRED_OUT))
+#define PORT_IMAGE_PUR(LIST,P)                   PORT_IMAGE(PORT_RESET_PUR(P), PORT_PINS(LIST, P, PORT_PRED_IN), PORT_PINS(LIST, P, PORT_PRED_PULL_UP))
+#define PORT_IMAGE_PDR(LIST,P)                   PORT_IMAGE(PORT_RESET_PDR(P), PORT_PINS(LIST, P, PORT_PRED_IN), PORT_PINS(LIST, P, PORT_PRED_PULL_DOWN))
+
+/* Bit of the register REG in the write mask when its image differs from its reset value */
+#define PORT_WRITE_BIT(LIST,P,REG)               ((PORT_IMAGE_##REG(LIST, P) != PORT_RESET_##REG(P)) ? (1U << PORT_REG_##REG) : 0U)
+
+/* Registers of port P written by Port_Init, the ones whose image differs from their reset value */
+#define PORT_WRITE_MASK(LIST,P)\
+    (uint16)(PORT_WRITE_BIT(LIST, P, CR) | PORT_WRITE_BIT(LIST, P, AMSEL) | PORT_WRITE_BIT(LIST, P, PCTL) | PORT_WRITE_BIT(LIST, P, AFSEL)\
+           | PORT_WRITE_BIT(LIST, P, DR2R) | PORT_WRITE_BIT(LIST, P, DR4R) | PORT_WRITE_BIT(LIST, P, DR8R) | PORT_WRITE_BIT(LIST, P, SLR)\
+           | PORT_WRITE_BIT(LIST, P, ODR) | PORT_WRITE_BIT(LIST, P, DEN) | PORT_WRITE_BIT(LIST, P, DATA) | PORT_WRITE_BIT(LIST, P, DIR)\
+           | PORT_WRITE_BIT(LIST, P, PUR) | PORT_WRITE_BIT(LIST, P, PDR))
+
+/* Register images of port P in the order of Port_RegisterIndexType */
+#define PORT_PORT_IMAGE(LIST,P)\
+    {\
+        {\
+            PORT_IMAGE_CR(LIST, P), PORT_IMAGE_AMSEL(LIST, P), PORT_IMAGE_PCTL(LIST, P), PORT_IMAGE_AFSEL(LIST, P),\
+            PORT_IMAGE_DR2R(LIST, P), PORT_IMAGE_DR4R(LIST, P), PORT_IMAGE_DR8R(LIST, P), PORT_IMAGE_SLR(LIST, P), PORT_IMAGE_ODR(LIST, P),\
+            PORT_IMAGE_DEN(LIST, P), PORT_IMAGE_DATA(LIST, P), PORT_IMAGE_DIR(LIST, P), PORT_IMAGE_PUR(LIST, P), PORT_IMAGE_PDR(LIST, P)\
+        },\
+        PORT_WRITE_MASK(LIST, P),\
+        (uint8)PORT_PINS(LIST, P, PORT_PRED_DIR_FIXED)\
+    }
+
+/* Bit of port P in the SYSCTL GPIO registers when the configuration set built from LIST writes any of its registers */
+#define PORT_USED_PORT(LIST,P)                   ((PORT_WRITE_MASK(LIST, P) != 0U) ? (1U << (P)) : 0U)
+
+/* Ports accessed by the configuration set built from LIST */
+#define PORT_USED_PORTS(LIST)                    (PORT_USED_PORT(LIST, PORT_PORTA_ID) | PORT_USED_PORT(LIST, PORT_PORTB_ID) | PORT_USED_PORT(LIST, PORT_PORTC_ID)\
+                                                | PORT_USED_PORT(LIST, PORT_PORTD_ID) | PORT_USED_PORT(LIST, PORT_PORTE_ID) | PORT_USED_PORT(LIST, PORT_PORTF_ID))
+
+/* Pins table and register images of all the ports of the configuration set built from LIST */
+#define PORT_PORT_IMAGE_REF(NAME,ENTRY,P,PRED)  &Port_##NAME##_Image,
+
+#define PORT_CONFIG_SET(PORTS)\
+    {\
+        {\
+            PORTS(PORT_PORT_PINS, PORT_PIN_CONFIG, 0, 0)\
+        },\
+        {\
+            PORTS(PORT_PORT_IMAGE_REF, 0, 0, 0)\
+        }\
+    }
+
+/* Number of the ports of a configuration set */
+#define PORT_PORT_COUNT_ONE(NAME,ENTRY,P,PRED)   + 1U
+#define PORT_PORTS_COUNT(PORTS)                  (0U PORTS(PORT_PORT_COUNT_ONE, 0, 0, 0))
+
+/*
+ * Delta builder used by Port_SwitchConfig:
+ * Bit n of a port entry is set when register n has to be written to move this port from the set FROM to the set TO.
+ * GPIODATA is also written for the pins that become outputs so that they start driving their initial level.
+ */
+#define PORT_CHANGE_BIT(FROM,TO,P,REG)           ((PORT_IMAGE_##REG(FROM, P) != PORT_IMAGE_##REG(TO, P)) ? (1U << PORT_REG_##REG) : 0U)
+#define PORT_CHANGE_DATA_BIT(FROM,TO,P)          (((PORT_IMAGE_DATA(FROM, P) != PORT_IMAGE_DATA(TO, P))\
+                                                  || (PORT_IMAGE_DIR(TO, P) & ~PORT_IMAGE_DIR(FROM, P))) ? (1U << PORT_REG_DATA) : 0U)
+
+#define PORT_PORT_DELTA(FROM,TO,P)\
+    (uint16)(PORT_CHANGE_BIT(FROM, TO, P, CR) | PORT_CHANGE_BIT(FROM, TO, P, AMSEL) | PORT_CHANGE_BIT(FROM, TO, P, PCTL)\
+           | PORT_CHANGE_BIT(FROM, TO, P, AFSEL) | PORT_CHANGE_BIT(FROM, TO, P, DR2R) | PORT_CHANGE_BIT(FROM, TO, P, DR4R)\
+           | PORT_CHANGE_BIT(FROM, TO, P, DR8R) | PORT_CHANGE_BIT(FROM, TO, P, SLR) | PORT_CHANGE_BIT(FROM, TO, P, ODR)\
+           | PORT_CHANGE_BIT(FROM, TO, P, DEN) | PORT_CHANGE_DATA_BIT(FROM, TO, P)\
+           | PORT_CHANGE_BIT(FROM, TO, P, DIR) | PORT_CHANGE_BIT(FROM, TO, P, PUR) | PORT_CHANGE_BIT(FROM, TO, P, PDR))
+
+#define PORT_CONFIG_DELTA(FROM,TO)\
+    {\
+        {\
+            PORT_PORT_DELTA(FROM, TO, PORT_PORTA_ID), PORT_PORT_DELTA(FROM, TO, PORT_PORTB_ID), PORT_PORT_DELTA(FROM, TO, PORT_PORTC_ID),\
+            PORT_PORT_DELTA(FROM, TO, PORT_PORTD_ID), PORT_PORT_DELTA(FROM, TO, PORT_PORTE_ID), PORT_PORT_DELTA(FROM, TO, PORT_PORTF_ID)\
+        }\
+    }
+
+/* Register images of the pins lists of every port, referenced by the configuration sets */
+STATIC const Port_PortImageType Port_PORTA_Image         = PORT_PORT_IMAGE(PORT_PORTA_PINS, PORT_PORTA_ID);
+STATIC const Port_PortImageType Port_PORTB_Image         = PORT_PORT_IMAGE(PORT_PORTB_PINS, PORT_PORTB_ID);
+STATIC const Port_PortImageType Port_PORTC_Image         = PORT_PORT_IMAGE(PORT_PORTC_PINS, PORT_PORTC_ID);
+STATIC const Port_PortImageType Port_PORTD_Image         = PORT_PORT_IMAGE(PORT_PORTD_PINS, PORT_PORTD_ID);
+STATIC const Port_PortImageType Port_PORTE_Image         = PORT_PORT_IMAGE(PORT_PORTE_PINS, PORT_PORTE_ID);
+STATIC const Port_PortImageType Port_PORTF_Image         = PORT_PORT_IMAGE(PORT_PORTF_PINS, PORT_PORTF_ID);
+STATIC const Port_PortImageType Port_PORTF_STANDBY_Image = PORT_PORT_IMAGE(PORT_PORTF_STANDBY_PINS, PORT_PORTF_ID);
+
+/* PB structure used with PORT_Init API, normal operating mode */
+const Port_ConfigType Port_Configuration = PORT_CONFIG_SET(PORT_NORMAL_PORTS);
+
+/* PB structure of the standby operating mode, selected with Port_SwitchConfig */
+const Port_ConfigType Port_StandbyConfiguration = PORT_CONFIG_SET(PORT_STANDBY_PORTS);
+
+/* A compile error here means that a configuration set does not list one pins list per port */
+typedef uint8 Port_NormalPortsCheck[(PORT_PORTS_COUNT(PORT_NORMAL_PORTS) == PORT_CONFIGURED_PORTS) ? 1 : -1];
+typedef uint8 Port_StandbyPortsCheck[(PORT_PORTS_COUNT(PORT_STANDBY_PORTS) == PORT_CONFIGURED_PORTS) ? 1 : -1];
+
+/* A compile error here means that a pin uses a Function that is not listed for its pin and mode */
+typedef uint8 Port_NormalFunctionsCheck[PORT_CHECK_FUNCTIONS(PORT_NORMAL_PINS_LIST) ? 1 : -1];
+typedef uint8 Port_StandbyFunctionsCheck[PORT_CHECK_FUNCTIONS(PORT_STANDBY_PINS_LIST) ? 1 : -1];
+
+/* A compile error here means that a pins list or PORT_PIN_FUNCTIONS_LIST is not sorted by port and pin */
+typedef uint8 Port_NormalPinsOrderCheck[PORT_CHECK_PINS_ORDER(PORT_NORMAL_PINS_LIST) ? 1 : -1];
+typedef uint8 Port_StandbyPinsOrderCheck[PORT_CHECK_PINS_ORDER(PORT_STANDBY_PINS_LIST) ? 1 : -1];
+typedef uint8 Port_FunctionsOrderCheck[PORT_CHECK_FUNCTIONS_ORDER() ? 1 : -1];
+
+/* Alternate functions of the pins used by Port_SetPinMode */
+const Port_PinFunctionType Port_PinFunctions[PORT_PIN_FUNCTIONS] =
+{
+    PORT_PIN_FUNCTIONS_LIST(PORT_PIN_FUNCTION, 0, 0, 0, 0)
+};
+
+/* Ports accessed by any of the configuration sets, only their clocks are enabled by the Mcu driver */
+const uint8 Port_UsedPortsMask = (uint8)(PORT_USED_PORTS(PORT_NORMAL_PINS_LIST) | PORT_USED_PORTS(PORT_STANDBY_PINS_LIST));
+
+/* Configuration sets indexed by their ID in Port_Cfg.h */
+const Port_ConfigType * const Port_ConfigSets[PORT_CONFIG_SETS] =
+{
+    &Port_Configuration,
+    &Port_StandbyConfiguration
+};
+
+/* Registers to be written to switch between every two configuration sets [From][To] */
+const Port_ConfigDeltaType Port_ConfigDeltas[PORT_CONFIG_SETS][PORT_CONFIG_SETS] =
+{
+    {
+        PORT_CONFIG_DELTA(PORT_NORMAL_PINS_LIST, PORT_NORMAL_PINS_LIST),
+        PORT_CONFIG_DELTA(PORT_NORMAL_PINS_LIST, PORT_STANDBY_PINS_LIST)
+    },
+    {
+        PORT_CONFIG_DELTA(PORT_STANDBY_PINS_LIST, PORT_NORMAL_PINS_LIST),
+        PORT_CONFIG_DELTA(PORT_STANDBY_PINS_LIST, PORT_STANDBY_PINS_LIST)
+    }
+};
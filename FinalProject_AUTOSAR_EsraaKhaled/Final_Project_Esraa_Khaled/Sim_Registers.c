@@ -0,0 +1,732 @@
+/*
+ * Module: Sim
+ * File Name: Sim_Registers.c
+ * Description: Source file for the host peripheral model of the TM4C123GH6PM Microcontroller.
+ *              Compiled only when HOST_SIMULATION is defined, see Sim_Registers.h for the build command.
+ * Author: Esraa Khaled
+ */
+
+#ifdef HOST_SIMULATION
+
+/* POSIX signals and interval timers are used to model the SysTick interrupt */
+#define _DEFAULT_SOURCE
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <time.h>
+
+#include "Sim_Registers.h"
+#include "tm4c123gh6pm_registers.h"
+
+/* SysTick ISR of the Gpt driver, executed on every simulated SysTick interrupt */
+extern void SysTick_Handler(void);
+
+/* Size of the address space of one GPIO port on both apertures */
+#define SIM_GPIO_PORT_SIZE                (0x1000U)
+
+/* Offsets 0x000 --> 0x3FC of a port are the masked DATA aperture, the control registers start after it */
+#define SIM_GPIO_DATA_APERTURE_END        (0x400U)
+#define SIM_GPIO_CONTROL_REGISTERS        ((SIM_GPIO_PORT_SIZE - SIM_GPIO_DATA_APERTURE_END) >> 2)
+#define SIM_GPIO_REG_INDEX(OFFSET)        (((OFFSET) - SIM_GPIO_DATA_APERTURE_END) >> 2)
+
+/* Value written to GPIOLOCK to unlock the GPIOCR register */
+#define SIM_GPIO_LOCK_KEY                 (0x4C4F434BUL)
+
+/* Bit-band alias region covers the 1MB peripheral bit-band region (32 words per byte) */
+#define SIM_BIT_BAND_ALIAS_SIZE           (0x02000000UL)
+
+/* SysTick Control and Status register bits */
+#define SIM_SYSTICK_CTRL_ENABLE           (0x00000001UL)
+#define SIM_SYSTICK_CTRL_INTEN            (0x00000002UL)
+#define SIM_SYSTICK_CTRL_COUNT            (0x00010000UL)
+#define SIM_SYSTICK_RELOAD_MASK           (0x00FFFFFFUL)
+
+/* PLL lock raw interrupt status bit in SYSCTL RIS register, the simulated PLL is always locked */
+#define SIM_SYSCTL_RIS_PLLLRIS            (0x00000040UL)
+
+/* SYSCTL RCC/RCC2 register fields selecting the core clock */
+#define SIM_RCC_BYPASS                    (0x00000800UL)
+#define SIM_RCC_PWRDN                     (0x00002000UL)
+#define SIM_RCC_OSCSRC_MASK               (0x00000030UL)
+#define SIM_RCC_OSCSRC_POS                (4U)
+#define SIM_RCC_SYSDIV_MASK               (0x07800000UL)
+#define SIM_RCC_SYSDIV_POS                (23U)
+#define SIM_RCC2_USERCC2                  (0x80000000UL)
+#define SIM_RCC2_DIV400                   (0x40000000UL)
+#define SIM_RCC2_SYSDIV2_MASK             (0x1F800000UL)
+#define SIM_RCC2_SYSDIV2_POS              (23U)
+#define SIM_RCC2_SYSDIV400_MASK           (0x1FC00000UL)
+#define SIM_RCC2_SYSDIV400_POS            (22U)
+#define SIM_RCC2_PWRDN2                   (0x00002000UL)
+#define SIM_RCC2_BYPASS2                  (0x00000800UL)
+#define SIM_RCC2_OSCSRC2_MASK             (0x00000070UL)
+#define SIM_RCC2_OSCSRC2_POS              (4U)
+
+/* DWT cycle counter enable bits: TRCENA in DEMCR and CYCCNTENA in DWT_CTRL */
+#define SIM_DEMCR_TRCENA                  (0x01000000UL)
+#define SIM_DWT_CTRL_CYCCNTENA            (0x00000001UL)
+
+/* Number of the registers that are modeled as plain storage (SYSCTL, NVIC, ...) */
+#define SIM_STORED_REGISTERS              (32U)
+
+/* State of one GPIO port */
+typedef struct
+{
+    /* Output data latch written through the DATA aperture */
+    uint8 Data;
+    /* Pins driven from outside the MCU and their levels */
+    uint8 External_Mask;
+    uint8 External_Level;
+    /* TRUE after writing the key to GPIOLOCK */
+    boolean Unlocked;
+    /* Control registers at offsets 0x400 --> 0xFFC */
+    uint32 Regs[SIM_GPIO_CONTROL_REGISTERS];
+}Sim_GpioPortType;
+
+/* Register that has no behavior except keeping its value */
+typedef struct
+{
+    uint32 Address;
+    uint32 Value;
+}Sim_StoredRegisterType;
+
+STATIC const uint32 Sim_GpioApbBaseAddress[SIM_GPIO_PORTS] =
+{
+    GPIO_PORTA_BASE_ADDRESS, GPIO_PORTB_BASE_ADDRESS, GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS, GPIO_PORTE_BASE_ADDRESS, GPIO_PORTF_BASE_ADDRESS
+};
+
+STATIC const uint32 Sim_GpioAhbBaseAddress[SIM_GPIO_PORTS] =
+{
+    GPIO_PORTA_AHB_BASE_ADDRESS, GPIO_PORTB_AHB_BASE_ADDRESS, GPIO_PORTC_AHB_BASE_ADDRESS,
+    GPIO_PORTD_AHB_BASE_ADDRESS, GPIO_PORTE_AHB_BASE_ADDRESS, GPIO_PORTF_AHB_BASE_ADDRESS
+};
+
+STATIC Sim_GpioPortType Sim_GpioPorts[SIM_GPIO_PORTS];
+
+/* Stored registers, the first entries hold the reset values of the SYSCTL registers used by the drivers */
+STATIC Sim_StoredRegisterType Sim_StoredRegisters[SIM_STORED_REGISTERS] =
+{
+    {SYSCTL_RCC_REG_ADDRESS,       0x078E3AD1UL},
+    {SYSCTL_RCC2_REG_ADDRESS,      0x07C06810UL},
+    {SYSCTL_GPIOHBCTL_REG_ADDRESS, 0x00007E00UL},
+    {SYSCTL_RCGCGPIO_REG_ADDRESS,  0x00000000UL},
+};
+STATIC uint8 Sim_StoredRegistersCount = 4U;
+
+/* SysTick registers */
+STATIC volatile uint32 Sim_SysTickCtrl    = 0U;
+STATIC volatile uint32 Sim_SysTickReload  = 0U;
+/* Reload value of the running host timer, a new RELOAD is applied at the next wrap like the HW */
+STATIC volatile uint32 Sim_SysTickArmedReload = 0U;
+/* Host time of the last reload of the counter in nanoseconds */
+STATIC volatile uint64 Sim_SysTickReloadTime  = 0U;
+
+/* DWT cycle counter: value at the host time of its last update, it counts from there while it is enabled */
+STATIC uint32 Sim_CycleCountBase = 0U;
+STATIC uint64 Sim_CycleCountTime = 0U;
+
+/* Mask of the SysTick signal used as the PRIMASK of the simulated CPU */
+STATIC sigset_t Sim_InterruptMask;
+
+STATIC boolean Sim_Initialized = FALSE;
+STATIC boolean Sim_TraceEnabled = FALSE;
+STATIC uint64 Sim_StartTime = 0U;
+
+/* Register reads and writes of the drivers since the last Sim_ResetAccessCount */
+STATIC volatile uint32 Sim_ReadCount  = 0U;
+STATIC volatile uint32 Sim_WriteCount = 0U;
+
+
+/*Private Functions*/
+
+STATIC uint64 Sim_GetHostTime(void)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64)now.tv_sec * 1000000000ULL) + (uint64)now.tv_nsec;
+}
+
+/* Bus fault model: report the faulty access and stop like the default fault handler of the startup file */
+STATIC void Sim_Fault(const char *Reason, uint32 Address)
+{
+    fprintf(stderr, "[SIM] fault: %s (address 0x%08X)\n", Reason, (unsigned int)Address);
+    abort();
+}
+
+STATIC uint32 *Sim_FindStoredRegister(uint32 Address)
+{
+    uint8 index;
+    for(index = 0; index < Sim_StoredRegistersCount; index++)
+    {
+        if(Sim_StoredRegisters[index].Address == Address)
+        {
+            return &Sim_StoredRegisters[index].Value;
+        }
+    }
+    return NULL_PTR;
+}
+
+STATIC uint32 Sim_ReadStoredRegister(uint32 Address)
+{
+    uint32 *value = Sim_FindStoredRegister(Address);
+    return (value != NULL_PTR) ? *value : 0U;
+}
+
+STATIC void Sim_WriteStoredRegister(uint32 Address, uint32 Value)
+{
+    uint32 *value = Sim_FindStoredRegister(Address);
+    if(value == NULL_PTR)
+    {
+        if(Sim_StoredRegistersCount >= SIM_STORED_REGISTERS)
+        {
+            Sim_Fault("too many modeled registers", Address);
+        }
+        Sim_StoredRegisters[Sim_StoredRegistersCount].Address = Address;
+        value = &Sim_StoredRegisters[Sim_StoredRegistersCount].Value;
+        Sim_StoredRegistersCount++;
+    }
+    *value = Value;
+}
+
+/*
+ * Core clock selected by RCC/RCC2: the PLL output divided by the system divider when it is not bypassed,
+ * the raw oscillator otherwise (OSCSRC 0 --> main oscillator, 1 --> PIOSC, 2 --> PIOSC/4).
+ * The system divider of the raw oscillator (USESYSDIV) is not modeled.
+ */
+STATIC uint32 Sim_GetCoreClock(void)
+{
+    uint32 rcc  = Sim_ReadStoredRegister(SYSCTL_RCC_REG_ADDRESS);
+    uint32 rcc2 = Sim_ReadStoredRegister(SYSCTL_RCC2_REG_ADDRESS);
+    uint32 oscSource;
+
+    if(rcc2 & SIM_RCC2_USERCC2)
+    {
+        if(!(rcc2 & (SIM_RCC2_BYPASS2 | SIM_RCC2_PWRDN2)))
+        {
+            if(rcc2 & SIM_RCC2_DIV400)
+            {
+                return SIM_PLL_CLOCK_HZ / (((rcc2 & SIM_RCC2_SYSDIV400_MASK) >> SIM_RCC2_SYSDIV400_POS) + 1U);
+            }
+            return (SIM_PLL_CLOCK_HZ / 2U) / (((rcc2 & SIM_RCC2_SYSDIV2_MASK) >> SIM_RCC2_SYSDIV2_POS) + 1U);
+        }
+        oscSource = (rcc2 & SIM_RCC2_OSCSRC2_MASK) >> SIM_RCC2_OSCSRC2_POS;
+    }
+    else
+    {
+        if(!(rcc & (SIM_RCC_BYPASS | SIM_RCC_PWRDN)))
+        {
+            return (SIM_PLL_CLOCK_HZ / 2U) / (((rcc & SIM_RCC_SYSDIV_MASK) >> SIM_RCC_SYSDIV_POS) + 1U);
+        }
+        oscSource = (rcc & SIM_RCC_OSCSRC_MASK) >> SIM_RCC_OSCSRC_POS;
+    }
+
+    return (oscSource == 0U) ? SIM_MOSC_CLOCK_HZ : (oscSource == 2U) ? (SIM_PIOSC_CLOCK_HZ / 4U) : SIM_PIOSC_CLOCK_HZ;
+}
+
+/* Start the host timer with the period of RELOAD + 1 system clock cycles, 0 stops it */
+STATIC void Sim_ArmSysTick(uint32 Reload)
+{
+    struct itimerval timer;
+    uint64 periodUs = 0U;
+
+    memset(&timer, 0, sizeof(timer));
+    if(Reload != 0U)
+    {
+        periodUs = ((uint64)Reload + 1U) * 1000000ULL / Sim_GetCoreClock();
+        if(periodUs == 0U)
+        {
+            periodUs = 1U;
+        }
+        timer.it_value.tv_sec  = (time_t)(periodUs / 1000000ULL);
+        timer.it_value.tv_usec = (suseconds_t)(periodUs % 1000000ULL);
+        timer.it_interval      = timer.it_value;
+    }
+    Sim_SysTickArmedReload = Reload;
+    setitimer(ITIMER_REAL, &timer, NULL);
+}
+
+/* Host timer signal: the counter reached 0 and was reloaded */
+STATIC void Sim_SysTickExpired(int Signal)
+{
+    (void)Signal;
+
+    Sim_SysTickCtrl      |= SIM_SYSTICK_CTRL_COUNT;
+    Sim_SysTickReloadTime = Sim_GetHostTime();
+
+    /* RELOAD was changed while the timer is running, the HW applies it from this wrap */
+    if(Sim_SysTickReload != Sim_SysTickArmedReload)
+    {
+        Sim_ArmSysTick(Sim_SysTickReload);
+    }
+
+    if(Sim_SysTickCtrl & SIM_SYSTICK_CTRL_INTEN)
+    {
+        SysTick_Handler();
+    }
+}
+
+STATIC void Sim_Init(void)
+{
+    struct sigaction action;
+    Sim_GpioPortType *port = NULL_PTR;
+    uint8 portIndex;
+
+    Sim_Initialized  = TRUE;
+    Sim_TraceEnabled = (getenv("MCAL_SIM_TRACE") != NULL) ? TRUE : FALSE;
+    Sim_StartTime    = Sim_GetHostTime();
+
+    /* The trace lines are printed as they happen */
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    /* GPIO reset values, 2-mA drive on all the pins, only PC0-PC3 (JTAG) leave reset with a digital function */
+    for(portIndex = 0; portIndex < SIM_GPIO_PORTS; portIndex++)
+    {
+        port = &Sim_GpioPorts[portIndex];
+        memset(port, 0, sizeof(*port));
+        port->Regs[SIM_GPIO_REG_INDEX(PORT_CR_REG_OFFSET)]   = 0xFFU;
+        port->Regs[SIM_GPIO_REG_INDEX(PORT_DR2R_REG_OFFSET)] = 0xFFU;
+    }
+    Sim_GpioPorts[2].Regs[SIM_GPIO_REG_INDEX(PORT_CR_REG_OFFSET)]    = 0xF0U;
+    Sim_GpioPorts[2].Regs[SIM_GPIO_REG_INDEX(PORT_AFSEL_REG_OFFSET)] = 0x0FU;
+    Sim_GpioPorts[2].Regs[SIM_GPIO_REG_INDEX(PORT_PUR_REG_OFFSET)]   = 0x0FU;
+    Sim_GpioPorts[2].Regs[SIM_GPIO_REG_INDEX(PORT_DEN_REG_OFFSET)]   = 0x0FU;
+    Sim_GpioPorts[2].Regs[SIM_GPIO_REG_INDEX(PORT_PCTL_REG_OFFSET)]  = 0x00001111UL;
+    Sim_GpioPorts[3].Regs[SIM_GPIO_REG_INDEX(PORT_CR_REG_OFFSET)]    = 0x7FU;
+    Sim_GpioPorts[5].Regs[SIM_GPIO_REG_INDEX(PORT_CR_REG_OFFSET)]    = 0xFEU;
+
+    /* SysTick interrupt, interrupts are enabled after reset (PRIMASK = 0) */
+    sigemptyset(&Sim_InterruptMask);
+    sigaddset(&Sim_InterruptMask, SIGALRM);
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = Sim_SysTickExpired;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags   = SA_RESTART;
+    sigaction(SIGALRM, &action, NULL);
+}
+
+/* Find the port of a GPIO address and check that it is accessible like the HW does */
+STATIC Sim_GpioPortType *Sim_DecodeGpio(uint32 Address, uint32 *Offset, uint8 *PortId)
+{
+    uint8 portIndex;
+    boolean ahbAperture;
+
+    for(portIndex = 0; portIndex < SIM_GPIO_PORTS; portIndex++)
+    {
+        if((Address - Sim_GpioApbBaseAddress[portIndex]) < SIM_GPIO_PORT_SIZE)
+        {
+            ahbAperture = FALSE;
+        }
+        else if((Address - Sim_GpioAhbBaseAddress[portIndex]) < SIM_GPIO_PORT_SIZE)
+        {
+            ahbAperture = TRUE;
+        }
+        else
+        {
+            continue;
+        }
+
+        /* A port is accessible only when its clock is enabled and only on the aperture selected in GPIOHBCTL */
+        if(!(Sim_ReadStoredRegister(SYSCTL_RCGCGPIO_REG_ADDRESS) & (1UL << portIndex)))
+        {
+            Sim_Fault("GPIO access with the port clock disabled", Address);
+        }
+        if(ahbAperture != ((Sim_ReadStoredRegister(SYSCTL_GPIOHBCTL_REG_ADDRESS) & (1UL << portIndex)) ? TRUE : FALSE))
+        {
+            Sim_Fault("GPIO access on the aperture not selected in GPIOHBCTL", Address);
+        }
+
+        *Offset = Address & (SIM_GPIO_PORT_SIZE - 1U);
+        *PortId = portIndex;
+        return &Sim_GpioPorts[portIndex];
+    }
+    return NULL_PTR;
+}
+
+/* Level of all the pins of a port as seen on the board */
+STATIC uint8 Sim_GpioPinsLevel(const Sim_GpioPortType *Port)
+{
+    uint8 direction = (uint8)Port->Regs[SIM_GPIO_REG_INDEX(PORT_DIR_REG_OFFSET)];
+    uint8 openDrain = (uint8)Port->Regs[SIM_GPIO_REG_INDEX(PORT_ODR_REG_OFFSET)];
+    uint8 pullUp    = (uint8)Port->Regs[SIM_GPIO_REG_INDEX(PORT_PUR_REG_OFFSET)];
+    uint8 input     = (uint8)((Port->External_Level & Port->External_Mask) | (pullUp & (uint8)~Port->External_Mask));
+    /* An open drain output only drives the low level, it releases the pin when its latch is high */
+    uint8 driven    = (uint8)(direction & ~(openDrain & Port->Data));
+
+    return (uint8)((Port->Data & driven) | (input & (uint8)~driven));
+}
+
+STATIC uint32 Sim_ReadGpio(Sim_GpioPortType *Port, uint32 Offset)
+{
+    uint8 digitalEnable;
+
+    if(Offset < SIM_GPIO_DATA_APERTURE_END)
+    {
+        /* Address bits [9:2] mask the pins that are read, pins without digital function read as 0 */
+        digitalEnable = (uint8)Port->Regs[SIM_GPIO_REG_INDEX(PORT_DEN_REG_OFFSET)];
+        return (uint32)(Sim_GpioPinsLevel(Port) & digitalEnable & (uint8)(Offset >> 2));
+    }
+    else if(Offset == PORT_LOCK_REG_OFFSET)
+    {
+        return (Port->Unlocked == TRUE) ? 0U : 1U;
+    }
+    else
+    {
+        return Port->Regs[SIM_GPIO_REG_INDEX(Offset)];
+    }
+}
+
+STATIC void Sim_WriteGpio(Sim_GpioPortType *Port, uint8 PortId, uint32 Offset, uint32 Value)
+{
+    uint32 commit = Port->Regs[SIM_GPIO_REG_INDEX(PORT_CR_REG_OFFSET)];
+    uint8 oldLevel = Sim_GpioPinsLevel(Port);
+    uint8 mask;
+
+    if(Offset < SIM_GPIO_DATA_APERTURE_END)
+    {
+        /* Address bits [9:2] mask the bits of the output latch that are written */
+        mask       = (uint8)(Offset >> 2);
+        Port->Data = (uint8)((Port->Data & (uint8)~mask) | ((uint8)Value & mask));
+    }
+    else if(Offset == PORT_LOCK_REG_OFFSET)
+    {
+        Port->Unlocked = (Value == SIM_GPIO_LOCK_KEY) ? TRUE : FALSE;
+    }
+    else if(Offset == PORT_CR_REG_OFFSET)
+    {
+        /* GPIOCR can be changed only after unlocking the port */
+        if(Port->Unlocked == TRUE)
+        {
+            Port->Regs[SIM_GPIO_REG_INDEX(Offset)] = Value & 0xFFU;
+        }
+    }
+    else if((Offset == PORT_AFSEL_REG_OFFSET) || (Offset == PORT_PUR_REG_OFFSET)
+         || (Offset == PORT_PDR_REG_OFFSET) || (Offset == PORT_DEN_REG_OFFSET))
+    {
+        /* Commit protected registers, only the bits enabled in GPIOCR change */
+        Port->Regs[SIM_GPIO_REG_INDEX(Offset)] = (Port->Regs[SIM_GPIO_REG_INDEX(Offset)] & ~commit) | (Value & commit);
+
+        /* Enabling the pull-up of a pin disables its pull-down and vice versa */
+        if(Offset == PORT_PUR_REG_OFFSET)
+        {
+            Port->Regs[SIM_GPIO_REG_INDEX(PORT_PDR_REG_OFFSET)] &= ~(Value & commit);
+        }
+        else if(Offset == PORT_PDR_REG_OFFSET)
+        {
+            Port->Regs[SIM_GPIO_REG_INDEX(PORT_PUR_REG_OFFSET)] &= ~(Value & commit);
+        }
+    }
+    else if((Offset == PORT_DR2R_REG_OFFSET) || (Offset == PORT_DR4R_REG_OFFSET) || (Offset == PORT_DR8R_REG_OFFSET))
+    {
+        /* Selecting a drive strength for a pin deselects the two others */
+        Port->Regs[SIM_GPIO_REG_INDEX(PORT_DR2R_REG_OFFSET)] &= ~Value;
+        Port->Regs[SIM_GPIO_REG_INDEX(PORT_DR4R_REG_OFFSET)] &= ~Value;
+        Port->Regs[SIM_GPIO_REG_INDEX(PORT_DR8R_REG_OFFSET)] &= ~Value;
+        Port->Regs[SIM_GPIO_REG_INDEX(Offset)] = Value & 0xFFU;
+    }
+    else
+    {
+        Port->Regs[SIM_GPIO_REG_INDEX(Offset)] = Value;
+    }
+
+    if((Sim_TraceEnabled == TRUE) && (Sim_GpioPinsLevel(Port) != oldLevel))
+    {
+        printf("[SIM] %10.3f ms PORT%c pins 0x%02X\n", (double)(Sim_GetHostTime() - Sim_StartTime) / 1000000.0,
+               'A' + PortId, Sim_GpioPinsLevel(Port));
+    }
+}
+
+STATIC uint32 Sim_ReadSysTickCurrent(void)
+{
+    uint64 elapsedTicks;
+
+    if(!(Sim_SysTickCtrl & SIM_SYSTICK_CTRL_ENABLE))
+    {
+        return 0U;
+    }
+    elapsedTicks = (Sim_GetHostTime() - Sim_SysTickReloadTime) * (Sim_GetCoreClock() / 1000000UL) / 1000U;
+    return Sim_SysTickArmedReload - (uint32)(elapsedTicks % ((uint64)Sim_SysTickArmedReload + 1U));
+}
+
+STATIC void Sim_WriteSysTickCtrl(uint32 Value)
+{
+    Sim_SysTickCtrl = (Sim_SysTickCtrl & SIM_SYSTICK_CTRL_COUNT) | (Value & ~SIM_SYSTICK_CTRL_COUNT);
+
+    if(Value & SIM_SYSTICK_CTRL_ENABLE)
+    {
+        Sim_SysTickReloadTime = Sim_GetHostTime();
+        Sim_ArmSysTick(Sim_SysTickReload);
+    }
+    else
+    {
+        Sim_ArmSysTick(0U);
+    }
+}
+
+/*
+ * Virtual CYCCNT: the host execution time converted to cycles of the current core clock.
+ * The host is faster than the target so the values are only meaningful relative to each other.
+ */
+STATIC uint32 Sim_ReadCycleCount(void)
+{
+    if((Sim_ReadStoredRegister(CORE_DEBUG_DEMCR_REG_ADDRESS) & SIM_DEMCR_TRCENA)
+       && (Sim_ReadStoredRegister(DWT_CTRL_REG_ADDRESS) & SIM_DWT_CTRL_CYCCNTENA))
+    {
+        return Sim_CycleCountBase
+               + (uint32)((Sim_GetHostTime() - Sim_CycleCountTime) * (Sim_GetCoreClock() / 1000000UL) / 1000U);
+    }
+    return Sim_CycleCountBase;
+}
+
+/* Freeze the counter value before its enable bits or its value change */
+STATIC void Sim_UpdateCycleCount(uint32 Value)
+{
+    Sim_CycleCountBase = Value;
+    Sim_CycleCountTime = Sim_GetHostTime();
+}
+
+
+/* One access of the CPU on the bus, the bit-band alias is expanded to the access of the word holding the bit */
+STATIC uint32 Sim_ReadBus(uint32 Address)
+{
+    Sim_GpioPortType *port = NULL_PTR;
+    uint32 offset = 0U;
+    uint32 byteAddress = 0U;
+    uint32 value = 0U;
+    uint8 portId = 0U;
+
+    if((Address - PERIPHERAL_BIT_BAND_ALIAS_ADDRESS) < SIM_BIT_BAND_ALIAS_SIZE)
+    {
+        /* alias = alias base + (byte offset * 32) + (bit number * 4) */
+        byteAddress = PERIPHERAL_BIT_BAND_BASE_ADDRESS + ((Address - PERIPHERAL_BIT_BAND_ALIAS_ADDRESS) >> 5);
+        return (Sim_ReadBus(byteAddress & ~3UL) >> (((byteAddress & 3U) << 3) + ((Address >> 2) & 7U))) & 1U;
+    }
+
+    port = Sim_DecodeGpio(Address, &offset, &portId);
+    if(port != NULL_PTR)
+    {
+        value = Sim_ReadGpio(port, offset);
+    }
+    else
+    {
+        switch(Address)
+        {
+        case SYSTICK_CTRL_REG_ADDRESS:
+            /* COUNT flag is cleared by reading the register */
+            value = Sim_SysTickCtrl;
+            Sim_SysTickCtrl &= ~SIM_SYSTICK_CTRL_COUNT;
+            break;
+        case SYSTICK_RELOAD_REG_ADDRESS:
+            value = Sim_SysTickReload;
+            break;
+        case SYSTICK_CURRENT_REG_ADDRESS:
+            value = Sim_ReadSysTickCurrent();
+            break;
+        case SYSCTL_PRGPIO_REG_ADDRESS:
+            /* Ports become ready as soon as their clock is enabled */
+            value = Sim_ReadStoredRegister(SYSCTL_RCGCGPIO_REG_ADDRESS) & 0x3FU;
+            break;
+        case SYSCTL_RIS_REG_ADDRESS:
+            value = Sim_ReadStoredRegister(Address) | SIM_SYSCTL_RIS_PLLLRIS;
+            break;
+        case DWT_CYCCNT_REG_ADDRESS:
+            value = Sim_ReadCycleCount();
+            break;
+        default:
+            value = Sim_ReadStoredRegister(Address);
+            break;
+        }
+    }
+    return value;
+}
+
+STATIC void Sim_WriteBus(uint32 Address, uint32 Value)
+{
+    Sim_GpioPortType *port = NULL_PTR;
+    uint32 offset = 0U;
+    uint32 byteAddress = 0U;
+    uint32 wordAddress = 0U;
+    uint32 bitMask = 0U;
+    uint8 portId = 0U;
+
+    if((Address - PERIPHERAL_BIT_BAND_ALIAS_ADDRESS) < SIM_BIT_BAND_ALIAS_SIZE)
+    {
+        /* Bit-band write is an atomic read-modify-write of the word that holds the bit */
+        byteAddress = PERIPHERAL_BIT_BAND_BASE_ADDRESS + ((Address - PERIPHERAL_BIT_BAND_ALIAS_ADDRESS) >> 5);
+        wordAddress = byteAddress & ~3UL;
+        bitMask     = 1UL << (((byteAddress & 3U) << 3) + ((Address >> 2) & 7U));
+        Sim_WriteBus(wordAddress, (Value & 1U) ? (Sim_ReadBus(wordAddress) | bitMask)
+                                               : (Sim_ReadBus(wordAddress) & ~bitMask));
+        return;
+    }
+
+    port = Sim_DecodeGpio(Address, &offset, &portId);
+    if(port != NULL_PTR)
+    {
+        Sim_WriteGpio(port, portId, offset, Value);
+    }
+    else
+    {
+        switch(Address)
+        {
+        case SYSTICK_CTRL_REG_ADDRESS:
+            Sim_WriteSysTickCtrl(Value);
+            break;
+        case SYSTICK_RELOAD_REG_ADDRESS:
+            Sim_SysTickReload = Value & SIM_SYSTICK_RELOAD_MASK;
+            break;
+        case SYSTICK_CURRENT_REG_ADDRESS:
+            /* Any write clears the counter and the COUNT flag */
+            Sim_SysTickReloadTime = Sim_GetHostTime();
+            Sim_SysTickCtrl &= ~SIM_SYSTICK_CTRL_COUNT;
+            break;
+        case SYSCTL_PRGPIO_REG_ADDRESS:
+            /* Read only */
+            break;
+        case DWT_CYCCNT_REG_ADDRESS:
+            Sim_UpdateCycleCount(Value);
+            break;
+        case CORE_DEBUG_DEMCR_REG_ADDRESS:
+        case DWT_CTRL_REG_ADDRESS:
+            Sim_UpdateCycleCount(Sim_ReadCycleCount());
+            Sim_WriteStoredRegister(Address, Value);
+            break;
+        default:
+            Sim_WriteStoredRegister(Address, Value);
+            break;
+        }
+    }
+}
+
+
+/*Function Definitions*/
+
+uint32 Sim_ReadRegister(uint32 Address)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    Sim_ReadCount++;
+    return Sim_ReadBus(Address);
+}
+
+void Sim_WriteRegister(uint32 Address, uint32 Value)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    Sim_WriteCount++;
+    Sim_WriteBus(Address, Value);
+}
+
+void Sim_SetPinLevel(uint8 PortId, uint8 PinNum, uint8 Level)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    Sim_GpioPorts[PortId].External_Mask |= (uint8)(1U << PinNum);
+    if(Level == STD_HIGH)
+    {
+        Sim_GpioPorts[PortId].External_Level |= (uint8)(1U << PinNum);
+    }
+    else
+    {
+        Sim_GpioPorts[PortId].External_Level &= (uint8)~(1U << PinNum);
+    }
+}
+
+void Sim_ReleasePin(uint8 PortId, uint8 PinNum)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    Sim_GpioPorts[PortId].External_Mask &= (uint8)~(1U << PinNum);
+}
+
+uint8 Sim_GetPinLevel(uint8 PortId, uint8 PinNum)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    return (uint8)((Sim_GpioPinsLevel(&Sim_GpioPorts[PortId]) >> PinNum) & 1U);
+}
+
+void Sim_EnableInterrupts(void)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    sigprocmask(SIG_UNBLOCK, &Sim_InterruptMask, NULL);
+}
+
+void Sim_DisableInterrupts(void)
+{
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    sigprocmask(SIG_BLOCK, &Sim_InterruptMask, NULL);
+}
+
+uint32 Sim_SaveAndDisableInterrupts(void)
+{
+    sigset_t oldMask;
+
+    if(Sim_Initialized == FALSE)
+    {
+        Sim_Init();
+    }
+    sigprocmask(SIG_BLOCK, &Sim_InterruptMask, &oldMask);
+    return (sigismember(&oldMask, SIGALRM) == 1) ? 1U : 0U;
+}
+
+void Sim_RestoreInterrupts(uint32 Primask)
+{
+    if(Primask == 0U)
+    {
+        Sim_EnableInterrupts();
+    }
+    else
+    {
+        /* The interrupts were masked by the caller, they stay masked */
+    }
+}
+
+void Sim_WaitForInterrupt(void)
+{
+    sigset_t noMask;
+
+    /*
+     * Sleep until the SysTick signal is delivered, a pending interrupt wakes up the CPU even when it is masked.
+     * Unlike the HW the ISR of a masked interrupt is executed here before returning.
+     */
+    sigemptyset(&noMask);
+    sigsuspend(&noMask);
+}
+
+void Sim_ResetAccessCount(void)
+{
+    Sim_ReadCount  = 0U;
+    Sim_WriteCount = 0U;
+}
+
+uint32 Sim_GetReadCount(void)
+{
+    return Sim_ReadCount;
+}
+
+uint32 Sim_GetWriteCount(void)
+{
+    return Sim_WriteCount;
+}
+
+#endif /* HOST_SIMULATION */
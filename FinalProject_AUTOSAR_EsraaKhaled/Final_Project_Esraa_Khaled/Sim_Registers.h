@@ -0,0 +1,74 @@
+/*
+ * Module: Sim
+ * File Name: Sim_Registers.h
+ * Description: Header file for the host peripheral model of the TM4C123GH6PM Microcontroller.
+ *              When HOST_SIMULATION is defined HW_REG_READ/HW_REG_WRITE route every register access of the
+ *              drivers to this model so the MCAL and the application run on a Linux PC without the board.
+ *              Modeled peripherals:
+ *              - GPIO ports A --> F on the APB and AHB apertures (masked DATA aperture, DIR, AFSEL, PUR, PDR,
+ *                DEN, LOCK/CR commit protection, AMSEL, PCTL, DR2R/DR4R/DR8R drive select, SLR, ODR open drain)
+ *                and the bit-band alias of the peripheral region
+ *              - SYSCTL clock gating of the GPIO ports (PRGPIO follows RCGCGPIO), the RCC/RCC2 core clock selection
+ *                (PIOSC, main oscillator or PLL with its divider) and the PLL lock status
+ *              - SysTick timer driven by a host interval timer which calls SysTick_Handler
+ *              - DWT cycle counter (CYCCNT) counting the host execution time in cycles of the core clock
+ *              Build and run from the project directory (tm4c123gh6pm_startup_ccs.c is compiled out):
+ *                  gcc -std=c99 -DHOST_SIMULATION -I. -o mcal_host *.c && ./mcal_host
+ *              Set MCAL_SIM_TRACE=1 in the environment to print every change of the output pins.
+ * Author: Esraa Khaled
+ */
+
+#ifndef SIM_REGISTERS_H_
+#define SIM_REGISTERS_H_
+
+#include "Std_Types.h"
+
+#ifdef HOST_SIMULATION
+
+/* Oscillators of the simulated MCU, the core clock follows the RCC/RCC2 selection written by Mcu_InitClock */
+#define SIM_PIOSC_CLOCK_HZ                (16000000UL)
+#define SIM_MOSC_CLOCK_HZ                 (16000000UL)
+#define SIM_PLL_CLOCK_HZ                  (400000000UL)
+
+/* Number of the modeled GPIO ports (PORTA --> PORTF) */
+#define SIM_GPIO_PORTS                    (6U)
+
+/*Function Prototypes*/
+
+/* Read the register at the absolute target address */
+uint32 Sim_ReadRegister(uint32 Address);
+
+/* Write the register at the absolute target address */
+void Sim_WriteRegister(uint32 Address, uint32 Value);
+
+/* Drive an input pin externally (button pressed/released...) */
+void Sim_SetPinLevel(uint8 PortId, uint8 PinNum, uint8 Level);
+
+/* Stop driving the pin externally, the pin level follows its pull resistors again */
+void Sim_ReleasePin(uint8 PortId, uint8 PinNum);
+
+/* Get the level of a pin as seen on the board */
+uint8 Sim_GetPinLevel(uint8 PortId, uint8 PinNum);
+
+/* PRIMASK model: mask/unmask the simulated interrupts */
+void Sim_EnableInterrupts(void);
+void Sim_DisableInterrupts(void);
+
+/* MRS PRIMASK + CPSID I and MSR PRIMASK model: 1 was returned if the interrupts were already masked */
+uint32 Sim_SaveAndDisableInterrupts(void);
+void Sim_RestoreInterrupts(uint32 Primask);
+
+/* WFI model: sleep until the next simulated interrupt is executed */
+void Sim_WaitForInterrupt(void);
+
+/*
+ * Bus access counter: every HW_REG_READ/HW_REG_WRITE counts as one register read/write, like one load/store
+ * of the CPU (a bit-band alias access is one access). HW_REG_SET_BITS/HW_REG_CLEAR_BITS count one of each.
+ */
+void Sim_ResetAccessCount(void);
+uint32 Sim_GetReadCount(void);
+uint32 Sim_GetWriteCount(void);
+
+#endif /* HOST_SIMULATION */
+
+#endif /* SIM_REGISTERS_H_ */
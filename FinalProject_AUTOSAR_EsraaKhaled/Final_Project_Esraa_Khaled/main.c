@@ -6,10 +6,10 @@
  */
 
 
-#include "Os.h"
+#include "OS.h"
 
 int main(void)
 {
-    /* Start the OS */
-    Os_start();
+    /* Start the OS, it returns only when the MCAL or the OS timer cannot be initialized */
+    return (E_OK == Os_start()) ? 0 : 1;
 }
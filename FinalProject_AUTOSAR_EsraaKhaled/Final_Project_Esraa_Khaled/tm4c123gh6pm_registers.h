@@ -1,7 +1,30 @@
 #ifndef TM4C123GH6PM_REGISTERS
 #define TM4C123GH6PM_REGISTERS
 
-#include "std_types.h"
+#include "Std_Types.h"
+
+/*****************************************************************************
+Register access
+*****************************************************************************/
+/*
+ * All the drivers access the peripheral registers through these macros using the absolute register address.
+ * On the target they are plain volatile loads and stores, when HOST_SIMULATION is defined they are routed
+ * to the host peripheral model in Sim_Registers.c so the drivers can be built and run on a PC.
+ */
+#ifdef HOST_SIMULATION
+#include "Sim_Registers.h"
+#define HW_REG_READ(ADDRESS)              Sim_ReadRegister((uint32)(ADDRESS))
+#define HW_REG_WRITE(ADDRESS,VALUE)       Sim_WriteRegister((uint32)(ADDRESS), (uint32)(VALUE))
+#else
+#define HW_REG_READ(ADDRESS)              (*((volatile uint32 *)(ADDRESS)))
+#define HW_REG_WRITE(ADDRESS,VALUE)       (*((volatile uint32 *)(ADDRESS)) = (uint32)(VALUE))
+#endif
+
+/* Read-modify-write of a register */
+#define HW_REG_SET_BITS(ADDRESS,MASK)     HW_REG_WRITE((ADDRESS), HW_REG_READ(ADDRESS) | (uint32)(MASK))
+#define HW_REG_CLEAR_BITS(ADDRESS,MASK)   HW_REG_WRITE((ADDRESS), HW_REG_READ(ADDRESS) & ~(uint32)(MASK))
+#define HW_REG_SET_BIT(ADDRESS,BIT)       HW_REG_SET_BITS((ADDRESS), 1UL << (BIT))
+#define HW_REG_CLEAR_BIT(ADDRESS,BIT)     HW_REG_CLEAR_BITS((ADDRESS), 1UL << (BIT))
 
 /*****************************************************************************
 GPIO registers (PORTA)
@@ -143,18 +166,43 @@ GPIO registers (PORTF)
 #define GPIO_PORTE_BASE_ADDRESS           0x40024000
 #define GPIO_PORTF_BASE_ADDRESS           0x40025000
 
+/* GPIO Registers base addresses on the Advanced High-Performance Bus (AHB) aperture */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
 #define PORT_DIR_REG_OFFSET               0x400
 #define PORT_AFSEL_REG_OFFSET             0x420
+#define PORT_DR2R_REG_OFFSET              0x500
+#define PORT_DR4R_REG_OFFSET              0x504
+#define PORT_DR8R_REG_OFFSET              0x508
+#define PORT_ODR_REG_OFFSET               0x50C
 #define PORT_PUR_REG_OFFSET               0x510
 #define PORT_PDR_REG_OFFSET               0x514
+#define PORT_SLR_REG_OFFSET               0x518
 #define PORT_DEN_REG_OFFSET               0x51C
 #define PORT_LOCK_REG_OFFSET              0x520
 #define PORT_CR_REG_OFFSET                0x524
 #define PORT_AMSEL_REG_OFFSET             0x528
 #define PORT_PCTL_REG_OFFSET              0x52C
 
+/* Peripheral bit-band region and its alias region (one word per bit) */
+#define PERIPHERAL_BIT_BAND_BASE_ADDRESS  0x40000000
+#define PERIPHERAL_BIT_BAND_ALIAS_ADDRESS 0x42000000
+
+/*
+ * Every bit of the peripheral bit-band region has its own word in the alias region:
+ * alias = alias base + (byte offset * 32) + (bit number * 4)
+ */
+#define PERIPHERAL_BIT_BAND_ALIAS(ADDRESS,BIT) (PERIPHERAL_BIT_BAND_ALIAS_ADDRESS\
+                                               + (((uint32)(ADDRESS) - PERIPHERAL_BIT_BAND_BASE_ADDRESS) << 5)\
+                                               + ((uint32)(BIT) << 2))
+
 /*****************************************************************************
 Systick Timer Registers
 *****************************************************************************/
@@ -162,6 +210,21 @@ Systick Timer Registers
 #define SYSTICK_RELOAD_REG        (*((volatile uint32 *)0xE000E014))
 #define SYSTICK_CURRENT_REG       (*((volatile uint32 *)0xE000E018))
 
+#define SYSTICK_CTRL_REG_ADDRESS          0xE000E010
+#define SYSTICK_RELOAD_REG_ADDRESS        0xE000E014
+#define SYSTICK_CURRENT_REG_ADDRESS       0xE000E018
+
+/*****************************************************************************
+Debug Exception and Monitor Control and Data Watchpoint and Trace Registers
+*****************************************************************************/
+#define CORE_DEBUG_DEMCR_REG      (*((volatile uint32 *)0xE000EDFC))
+#define DWT_CTRL_REG              (*((volatile uint32 *)0xE0001000))
+#define DWT_CYCCNT_REG            (*((volatile uint32 *)0xE0001004))
+
+#define CORE_DEBUG_DEMCR_REG_ADDRESS      0xE000EDFC
+#define DWT_CTRL_REG_ADDRESS              0xE0001000
+#define DWT_CYCCNT_REG_ADDRESS            0xE0001004
+
 /*****************************************************************************
 NVIC Registers
 *****************************************************************************/
@@ -222,6 +285,8 @@ System Control Block Registers
 #define NVIC_SYSTEM_INTCTRL       (*((volatile uint32 *)0xE000ED04))
 #define NVIC_SYSTEM_CFGCTRL       (*((volatile uint32 *)0xE000ED14))
 
+#define NVIC_SYSTEM_PRI3_REG_ADDRESS      0xE000ED20
+
 /*****************************************************************************
 MPU Registers
 *****************************************************************************/
@@ -378,6 +443,13 @@ System Control Registers
 #define SYSCTL_PREEPROM_REG       (*((volatile uint32 *)0x400FEA58))
 #define SYSCTL_PRWTIMER_REG       (*((volatile uint32 *)0x400FEA5C))
 
+#define SYSCTL_RIS_REG_ADDRESS            0x400FE050
+#define SYSCTL_RCC_REG_ADDRESS            0x400FE060
+#define SYSCTL_GPIOHBCTL_REG_ADDRESS      0x400FE06C
+#define SYSCTL_RCC2_REG_ADDRESS           0x400FE070
+#define SYSCTL_RCGCGPIO_REG_ADDRESS       0x400FE608
+#define SYSCTL_PRGPIO_REG_ADDRESS         0x400FEA08
+
 /*****************************************************************************
 UART0 Registers
 *****************************************************************************/
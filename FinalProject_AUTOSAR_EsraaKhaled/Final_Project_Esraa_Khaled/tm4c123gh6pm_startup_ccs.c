@@ -22,6 +22,10 @@
 //
 //*****************************************************************************
 
+// The startup code is for the target only, on the host (HOST_SIMULATION) the
+// C runtime of the host starts main() and Sim_Registers.c models SysTick.
+#ifndef HOST_SIMULATION
+
 #include <stdint.h>
 
 //*****************************************************************************
@@ -43,6 +47,14 @@ extern void SysTick_Handler(void);
 //*****************************************************************************
 extern void _c_int00(void);
 
+//*****************************************************************************
+//
+// External declaration for the Mcu routine that enables the clocks of the
+// GPIO ports before the C runtime initialization.
+//
+//*****************************************************************************
+extern void Mcu_StartPortClocks(void);
+
 //*****************************************************************************
 //
 // Linker variable that marks the top of the stack.
@@ -238,6 +250,13 @@ void (* const g_pfnVectors[])(void) =
 void
 ResetISR(void)
 {
+    //
+    // Enable the clocks of the used GPIO ports first, so they become ready
+    // while _c_int00 initializes .data and .bss instead of being waited for
+    // in Mcu_Init.
+    //
+    Mcu_StartPortClocks();
+
     //
     // Jump to the CCS C initialization routine.  This will enable the
     // floating-point unit as well, so that does not need to be done here.
@@ -299,3 +318,5 @@ IntDefaultHandler(void)
     {
     }
 }
+
+#endif // HOST_SIMULATION